@@ -6,6 +6,7 @@ typedef struct {
     btn_t up;
     btn_t pressed;
     btn_t old;
+    btn_t repeat;
     int16_t touchX;
     int16_t touchY;
     uint32_t touchPressed;
@@ -13,7 +14,12 @@ typedef struct {
 } InputContext;
 
 void Input_Update(void);
-u32 Input_WaitWithTimeout(u32 msec, u32 closingButton);
+// Makes buttons that are currently held count as already pressed, so they aren't reported again
+void Input_Reset(void);
+// Returns the buttons that were pressed (or are repeating) within msec milliseconds, or 0 on timeout.
+// A timeout of 0 waits forever.
+u32 Input_WaitWithTimeout(u32 msec);
+void Input_WaitForRelease(u32 buttons, u32 msec);
 u32 Input_Wait(void);
 
 extern InputContext rInputCtx;
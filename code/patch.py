@@ -1,4 +1,5 @@
 import os
+import re
 import struct
 import subprocess
 import sys
@@ -26,6 +27,24 @@ with open("../source/" + hppFile, 'w') as syms:
         syms.write("#define "+sym[2].replace("\\r", "").upper()+"_" + region + "_ADDR 0x"+sym[0]+"\n")
 print("wrote desired symbols to " + hppFile)
 
+# Document the auto-tracker block for external trackers, using the offsets written in autotracker.h
+with open("src/autotracker.h") as header:
+    autotrackerHeader = header.read()
+defines = dict(re.findall(r'#define (AUTOTRACKER_\w+) (\S+)', autotrackerHeader))
+fields = re.findall(r'/\* (0x[0-9A-F]+) \*/ (\w+)\s+(\w+)(?:\[\w+\])?;[ \t]*(?://[ \t]*(.*))?', autotrackerHeader)
+autotrackerAddr = [int(line.split()[0], 16) for line in nmLines if len(line.split()) >= 3 and line.split()[2].replace("\\r", "") == "gAutoTracker"]
+layoutFile = "autotracker_layout_" + region + ".md"
+with open(layoutFile, 'w') as layout:
+    layout.write("# Auto-tracker block (" + region + ")\n\n")
+    layout.write("Address: 0x{:08X}  \n".format(autotrackerAddr[0] if autotrackerAddr else 0))
+    layout.write("Magic: " + defines["AUTOTRACKER_MAGIC"] + ", version " + defines["AUTOTRACKER_VERSION"] + ", size " + defines["AUTOTRACKER_BLOCK_SIZE"] + " bytes  \n")
+    layout.write("Multi-byte values are little-endian. Bitsets are arrays of u32, bit `i` is `(word[i / 32] >> (i % 32)) & 1`.\n\n")
+    layout.write("| Offset | Size | Type | Field | Notes |\n|---|---|---|---|---|\n")
+    offsets = [int(field[0], 16) for field in fields] + [int(defines["AUTOTRACKER_BLOCK_SIZE"], 16)]
+    for i, (offset, fieldType, name, notes) in enumerate(fields):
+        layout.write("| {} | 0x{:X} | {} | {} | {} |\n".format(offset, offsets[i + 1] - offsets[i], fieldType, name, notes))
+print("wrote auto-tracker layout to " + layoutFile)
+
 off = lambda vaddr: struct.pack(">I",vaddr - 0x100000)[1:]
 sz = lambda size: struct.pack(">H", size)
 
@@ -7,6 +7,7 @@
 #include "common.h"
 #include "fairy.h"
 #include "icetrap.h"
+#include "spoiler_data.h"
 
 #define EnBox_Init_addr 0x1899EC
 #define EnBox_Init ((ActorFunc)EnBox_Init_addr)
@@ -165,7 +166,10 @@ u8 Chest_OverrideIceSmoke(Actor* thisx) {
 
     if (thisx != lastTrapChest && thisx->xzDistToPlayer < 50.0f) {
         lastTrapChest = thisx;
-        u32 pRandInt = dizzyCurseSeed = Hash(thisx->params);
+        ItemOverride override = ItemOverride_Lookup(thisx, gGlobalContext->sceneNum, 0);
+        u32 pRandInt = dizzyCurseSeed = IceTrap_GetSeed(override.key.all, thisx->params);
+        // Chest traps go off without giving an item
+        SpoilerData_SetOverrideCollected(override.key);
 
         u8 trapType = possibleChestTraps[pRandInt % possibleChestTrapsAmount];
 
@@ -213,7 +217,7 @@ u8 Chest_OverrideIceSmoke(Actor* thisx) {
                 PLAYER->actor.home.pos.y = -5000; // Make Link airborne for a frame to cancel the get item event
                 break;
             case ICETRAP_FIRE:
-                FireDamage(&(PLAYER->actor), gGlobalContext, gRandInt % 2);
+                FireDamage(&(PLAYER->actor), gGlobalContext, (pRandInt >> 8) % 2);
                 LinkDamage(gGlobalContext, PLAYER, 0, 0.0f, 0.0f, 0, 20);
                 break;
         }
@@ -307,7 +307,7 @@ void ShopsanityItem_Init(Actor* itemx, GlobalContext* globalCtx) {
     }
 
     override = ItemOverride_Lookup(&item->super.actor, globalCtx->sceneNum, item->getItemId);
-    if ((override.value.all == 0) || Shopsanity_CheckAlreadySold(item)) {
+    if ((override.value.itemId == 0) || Shopsanity_CheckAlreadySold(item)) {
         EnGirlA_Init(itemx, globalCtx);
     } else if (override.value.player == 0xFF) { // Special way to detect regular shop items
         EnGirlA_Init(itemx, globalCtx);
@@ -0,0 +1,66 @@
+#include "autotracker.h"
+#include "settings.h"
+#include "common.h"
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(sizeof(AutoTrackerBlock) == AUTOTRACKER_BLOCK_SIZE, "The auto-tracker block layout changed, update its offsets");
+_Static_assert(offsetof(AutoTrackerBlock, collected) == 0x07C, "The auto-tracker block layout changed, update its offsets");
+_Static_assert(offsetof(AutoTrackerBlock, entrancesDiscovered) == 0x0BC, "The auto-tracker block layout changed, update its offsets");
+
+// Linked at the start of the new code, see .autotracker in the linker scripts
+AutoTrackerBlock gAutoTracker __attribute__((section(".autotracker"))) = {
+    .magic   = AUTOTRACKER_MAGIC,
+    .version = AUTOTRACKER_VERSION,
+    .size    = sizeof(AutoTrackerBlock),
+};
+
+static u8 changed = 0;
+
+#define AutoTracker_Set(field, value)        \
+    do {                                     \
+        if (gAutoTracker.field != (value)) { \
+            gAutoTracker.field = (value);    \
+            changed = 1;                     \
+        }                                    \
+    } while (0)
+
+static void AutoTracker_Copy(void* dst, const void* src, size_t size) {
+    if (memcmp(dst, src, size) != 0) {
+        memcpy(dst, src, size);
+        changed = 1;
+    }
+}
+
+void AutoTracker_Update(void) {
+    changed = 0;
+
+    AutoTracker_Copy(gAutoTracker.hashIndexes, gSettingsContext.hashIndexes, sizeof(gAutoTracker.hashIndexes));
+    AutoTracker_Set(itemLocationsCount, gSpoilerData.ItemLocationsCount);
+    AutoTracker_Set(inGame, IsInGame());
+
+    if (gAutoTracker.inGame) {
+        AutoTracker_Set(sceneNum, gGlobalContext->sceneNum);
+        AutoTracker_Set(entranceIndex, (s16)gSaveContext.entranceIndex);
+        AutoTracker_Set(age, (u8)gSaveContext.linkAge);
+        AutoTracker_Set(currentMagic, gSaveContext.magic);
+        AutoTracker_Set(rupees, gSaveContext.rupees);
+        AutoTracker_Set(health, gSaveContext.health);
+        AutoTracker_Set(healthCapacity, gSaveContext.healthCapacity);
+        AutoTracker_Set(equipment, gSaveContext.equipment);
+        AutoTracker_Set(gsTokens, gSaveContext.gsTokens);
+        AutoTracker_Set(upgrades, gSaveContext.upgrades);
+        AutoTracker_Set(questItems, gSaveContext.questItems);
+        AutoTracker_Copy(gAutoTracker.items, gSaveContext.items, sizeof(gAutoTracker.items));
+        AutoTracker_Copy(gAutoTracker.dungeonKeys, gSaveContext.dungeonKeys, sizeof(gAutoTracker.dungeonKeys));
+        AutoTracker_Copy(gAutoTracker.dungeonItems, gSaveContext.dungeonItems, sizeof(gAutoTracker.dungeonItems));
+        AutoTracker_Copy(gAutoTracker.ammo, gSaveContext.ammo, sizeof(gAutoTracker.ammo));
+        AutoTracker_Copy(gAutoTracker.collected, gExtSaveData.collectedChecks, sizeof(gAutoTracker.collected));
+        AutoTracker_Copy(gAutoTracker.entrancesDiscovered, gExtSaveData.entrancesDiscovered,
+                         sizeof(gAutoTracker.entrancesDiscovered));
+    }
+
+    if (changed) {
+        gAutoTracker.changeCount++;
+    }
+}
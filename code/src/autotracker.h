@@ -0,0 +1,50 @@
+#ifndef _AUTOTRACKER_H_
+#define _AUTOTRACKER_H_
+
+#include "z3D/z3D.h"
+#include "spoiler_data.h"
+#include "savefile.h"
+
+// Tracker state kept at a fixed address (AUTOTRACKER_OFFSET), so emulator and capture card tools can
+// poll one small block instead of decoding gSaveContext. When the patch is built, patch.py writes
+// autotracker_layout_<region>.md from the offsets in the structure below.
+// Increment the version whenever the structure is changed.
+
+#define AUTOTRACKER_MAGIC 0x4B525441 // "ATRK"
+#define AUTOTRACKER_VERSION 1
+#define AUTOTRACKER_COLLECTED_WORDS SPOILER_COLLECTED_WORDS
+#define AUTOTRACKER_BLOCK_SIZE 0x1C4
+
+typedef struct {
+    /* 0x000 */ u32 magic;
+    /* 0x004 */ u16 version;
+    /* 0x006 */ u16 size;
+    /* 0x008 */ u32 changeCount;                 // Goes up after every change, the rest only needs reading when it's different
+    /* 0x00C */ u8  hashIndexes[5];              // Icons of the seed hash, to tell seeds apart
+    /* 0x011 */ u8  inGame;                      // 0 on the title screen and file select, the fields below are stale then
+    /* 0x012 */ u16 itemLocationsCount;          // Number of bits used in collected
+    /* 0x014 */ s16 sceneNum;
+    /* 0x016 */ s16 entranceIndex;               // Entrance the current scene was loaded with
+    /* 0x018 */ u8  age;                         // 0: Adult, 1: Child
+    /* 0x019 */ s8  currentMagic;
+    /* 0x01A */ s16 rupees;
+    /* 0x01C */ s16 health;
+    /* 0x01E */ u16 healthCapacity;
+    /* 0x020 */ u16 equipment;                   // Same bits as in the save context
+    /* 0x022 */ s16 gsTokens;
+    /* 0x024 */ u32 upgrades;                    // Same bits as in the save context
+    /* 0x028 */ u32 questItems;                  // Same bits as in the save context
+    /* 0x02C */ u8  items[26];                   // Item in each inventory slot, 0xFF when empty
+    /* 0x046 */ s8  dungeonKeys[19];             // Small keys, by scene
+    /* 0x059 */ u8  dungeonItems[20];            // Boss key, compass and map bits, by scene
+    /* 0x06D */ s8  ammo[15];                    // Ammo in each inventory slot
+    /* 0x07C */ u32 collected[AUTOTRACKER_COLLECTED_WORDS]; // One bit per check, indexed like gSpoilerData.ItemLocations
+    /* 0x0BC */ u32 entrancesDiscovered[SAVEFILE_ENTRANCES_DISCOVERED_IDX_COUNT]; // One bit per entrance index
+} AutoTrackerBlock;
+
+extern AutoTrackerBlock gAutoTracker;
+
+/// Brings the block up to date with the game, called once per frame
+void AutoTracker_Update(void);
+
+#endif //_AUTOTRACKER_H_
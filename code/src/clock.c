@@ -0,0 +1,83 @@
+#include "clock.h"
+#include "3ds/svc.h"
+#include "common.h"
+#include "savefile.h"
+
+// The HOME menu suspends the game without the sleep callbacks, so any longer gap between two
+// frames is assumed to be that and isn't counted
+#define MAX_FRAME_TICKS (TICKS_PER_SEC * 3)
+
+static u32 frameCount = 0;
+static u64 lastFrameTicks = 0;
+static u64 playTicks = 0; // Play time not yet added to the seconds in the ext save data
+static u64 sleepStartTick = 0;
+static u64 sleptTicks = 0;
+static bool isAsleep = false;
+static bool isMenuOpen = false;
+
+static void Clock_AddPlayTime(u64 ticks) {
+    if (!IsInGame()) {
+        return;
+    }
+    playTicks += ticks;
+    while (playTicks >= TICKS_PER_SEC) {
+        playTicks -= TICKS_PER_SEC;
+        ++gExtSaveData.playtimeSeconds;
+    }
+}
+
+void Clock_Update(void) {
+    if (isAsleep) {
+        return;
+    }
+
+    u64 now = Clock_GetTicks();
+    // The first update has nothing to measure from
+    if (lastFrameTicks != 0 && now - lastFrameTicks <= MAX_FRAME_TICKS) {
+        Clock_AddPlayTime(now - lastFrameTicks);
+    }
+    lastFrameTicks = now;
+    if (!isMenuOpen) {
+        frameCount++;
+    }
+}
+
+u32 Clock_GetFrameCount(void) {
+    return frameCount;
+}
+
+u64 Clock_GetTicks(void) {
+    u64 ticks = svcGetSystemTick() - sleptTicks;
+    // While asleep, time stands still at the moment the system went to sleep
+    return isAsleep ? sleepStartTick - sleptTicks : ticks;
+}
+
+u8 Clock_IsAsleep(void) {
+    return isAsleep;
+}
+
+void Clock_OnSleep(void) {
+    if (isAsleep) {
+        return;
+    }
+    sleepStartTick = svcGetSystemTick();
+    isAsleep = true;
+}
+
+void Clock_OnAwake(void) {
+    if (!isAsleep) {
+        return;
+    }
+    sleptTicks += svcGetSystemTick() - sleepStartTick;
+    isAsleep = false;
+}
+
+void Clock_OnMenuOpen(void) {
+    isMenuOpen = true;
+}
+
+void Clock_OnMenuClose(void) {
+    // Count the time spent waiting for the closing button to be let go too
+    Clock_Update();
+    isMenuOpen = false;
+}
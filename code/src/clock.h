@@ -0,0 +1,23 @@
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+#include "3ds/types.h"
+
+// Shared timing for the patch code. Everything that measures time should go through here,
+// so sleep and the menu pause are only dealt with in one place.
+
+/// Advances the play time, and the frame counter when the game isn't paused.
+/// Call once per frame, and regularly while the menu has the game paused
+void Clock_Update(void);
+/// Frames the game has run since boot, doesn't count while asleep or paused by the menu
+u32  Clock_GetFrameCount(void);
+/// System ticks since boot without the time spent asleep, for timeouts and intervals
+u64  Clock_GetTicks(void);
+u8   Clock_IsAsleep(void);
+void Clock_OnSleep(void);
+void Clock_OnAwake(void);
+/// The menu pauses the game, but the time spent in it still counts as play time
+void Clock_OnMenuOpen(void);
+void Clock_OnMenuClose(void);
+
+#endif //_CLOCK_H_
@@ -16,6 +16,8 @@ typedef enum {
     /* 0x08 */ LIGHT_MEDALLION,
 } DungeonReward;
 
+extern const char DungeonRewardNames[][25];
+
 const char* DungeonReward_GetName(u32 dungeonReward);
 
 #endif //_DUNGEON_REWARDS_H_
@@ -7,6 +7,7 @@
 #include "savefile.h"
 #include "common.h"
 #include "grotto.h"
+#include "spoiler_data.h"
 
 typedef void (*SetNextEntrance_proc)(struct GlobalContext* globalCtx, s16 entranceIndex, u32 sceneLoadFlag, u32 transition);
 #define SetNextEntrance_addr 0x3716F0
@@ -228,6 +229,7 @@ void Entrance_EnteredLocation(void) {
         return;
     }
     SaveFile_SetSceneDiscovered(gGlobalContext->sceneNum);
+    SpoilerData_OnSceneEntered();
 }
 
 //Properly respawn the player after a game over, accounding for dungeon entrance
@@ -717,3 +719,116 @@ void InitEntranceTrackingData(void) {
     SortEntranceList(rEntranceOverrides, 0);
     SortEntranceList(destList, 1);
 }
+
+u8 Entrance_IsDiscovered(s16 index) {
+    bool isDiscovered = SaveFile_GetIsEntranceDiscovered(index);
+    if (!isDiscovered) {
+        // If the pair included one of the hyrule field <-> zora's river entrances,
+        // the randomizer will have also overriden the water-based entrances, so check those too
+        if ((index == 0x00EA && SaveFile_GetIsEntranceDiscovered(0x01D9)) || (index == 0x01D9 && SaveFile_GetIsEntranceDiscovered(0x00EA))) {
+            isDiscovered = true;
+        } else if ((index == 0x0181 && SaveFile_GetIsEntranceDiscovered(0x0311)) || (index == 0x0311 && SaveFile_GetIsEntranceDiscovered(0x0181))) {
+            isDiscovered = true;
+        }
+    }
+    return isDiscovered;
+}
+
+#define ROUTE_NODE_WORDS ((SPOILER_ROUTE_NODES_MAX + 31) / 32)
+
+// Result of the last search: which nodes can be reached and the edge each one was first reached through
+static u16 routeStartNode = ROUTE_NODE_NONE;
+static u32 routeReachable[ROUTE_NODE_WORDS];
+static u16 routeParentNode[SPOILER_ROUTE_NODES_MAX];
+
+static bool Entrance_IsRouteEdgeKnown(const SpoilerRouteEdge* edge) {
+    return edge->DiscoverIndex == -1 || gSettingsContext.ingameSpoilers || Entrance_IsDiscovered(edge->DiscoverIndex);
+}
+
+// Finds the node the player is in from the entrance they came through. Entrances that don't have an
+// edge of their own (e.g. grottos, savewarps) fall back to the scene, as long as only one node uses it
+static u16 Entrance_FindCurrentRouteNode(void) {
+    u16 sceneNode = ROUTE_NODE_NONE;
+    bool sceneIsAmbiguous = false;
+    for (u16 i = 0; i < gSpoilerData.RouteNodeEdgeOffsets[gSpoilerData.RouteNodeCount]; i++) {
+        const SpoilerRouteEdge* edge = &gSpoilerData.RouteEdges[i];
+        if (edge->ArrivalIndex == gSaveContext.entranceIndex) {
+            return edge->TargetNode;
+        }
+        if (edge->ArrivalIndex >= 0 && edge->ArrivalIndex < ENTRANCE_TABLE_SIZE &&
+            gEntranceTable[edge->ArrivalIndex].scene == gGlobalContext->sceneNum) {
+            if (sceneNode != ROUTE_NODE_NONE && sceneNode != edge->TargetNode) {
+                sceneIsAmbiguous = true;
+            }
+            sceneNode = edge->TargetNode;
+        }
+    }
+    return sceneIsAmbiguous ? ROUTE_NODE_NONE : sceneNode;
+}
+
+void Entrance_UpdateRoutes(void) {
+    memset(routeReachable, 0, sizeof(routeReachable));
+    routeStartNode = Entrance_FindCurrentRouteNode();
+    if (routeStartNode == ROUTE_NODE_NONE) {
+        return;
+    }
+
+    // Breadth first search one level at a time, with the nodes of the current level kept in a bitset.
+    // Every node is expanded at most once, and the first edge that reaches a node is the shortest route
+    u32 frontier[ROUTE_NODE_WORDS] = { 0 };
+    u32 nextFrontier[ROUTE_NODE_WORDS];
+    frontier[routeStartNode / 32] = 1 << (routeStartNode % 32);
+    routeReachable[routeStartNode / 32] = frontier[routeStartNode / 32];
+    routeParentNode[routeStartNode] = ROUTE_NODE_NONE;
+
+    bool expanded = true;
+    while (expanded) {
+        expanded = false;
+        memset(nextFrontier, 0, sizeof(nextFrontier));
+        for (u16 word = 0; word < ROUTE_NODE_WORDS; word++) {
+            u32 bits = frontier[word];
+            while (bits != 0) {
+                u16 node = word * 32 + __builtin_ctz(bits);
+                bits &= bits - 1;
+                for (u16 i = gSpoilerData.RouteNodeEdgeOffsets[node]; i < gSpoilerData.RouteNodeEdgeOffsets[node + 1]; i++) {
+                    const SpoilerRouteEdge* edge = &gSpoilerData.RouteEdges[i];
+                    u32 targetBit = 1 << (edge->TargetNode % 32);
+                    if ((routeReachable[edge->TargetNode / 32] & targetBit) || !Entrance_IsRouteEdgeKnown(edge)) {
+                        continue;
+                    }
+                    routeReachable[edge->TargetNode / 32] |= targetBit;
+                    nextFrontier[edge->TargetNode / 32] |= targetBit;
+                    routeParentNode[edge->TargetNode] = node;
+                    expanded = true;
+                }
+            }
+        }
+        memcpy(frontier, nextFrontier, sizeof(frontier));
+    }
+}
+
+u16 Entrance_GetRouteStartNode(void) {
+    return routeStartNode;
+}
+
+u8 Entrance_IsRouteNodeReachable(u16 node) {
+    return node < gSpoilerData.RouteNodeCount && (routeReachable[node / 32] & (1 << (node % 32))) != 0;
+}
+
+u16 Entrance_GetRoute(u16 destNode, u16* route, u16 maxLength) {
+    if (!Entrance_IsRouteNodeReachable(destNode)) {
+        return 0;
+    }
+
+    // Walk back from the destination, then flip the nodes around so the route starts at the player
+    u16 length = 0;
+    for (u16 node = destNode; node != ROUTE_NODE_NONE && length < maxLength; node = routeParentNode[node]) {
+        route[length++] = node;
+    }
+    for (u16 i = 0; i < length / 2; i++) {
+        u16 temp = route[i];
+        route[i] = route[length - 1 - i];
+        route[length - 1 - i] = temp;
+    }
+    return length;
+}
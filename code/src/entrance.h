@@ -20,6 +20,7 @@
 #define LINK_HOUSE_SAVEWARP_ENTRANCE 0x00BB
 
 #define ENTRANCE_OVERRIDES_MAX_COUNT 256
+#define ROUTE_NODE_NONE 0xFFFF
 
 typedef struct {
     s16 index;
@@ -86,5 +87,14 @@ const EntranceData* GetEntranceData(s16 index);
 /// Returns the index that replaced the parameter index
 s16 Entrance_GetReplacementIndex(s16 index);
 void InitEntranceTrackingData(void);
+/// Returns whether the entrance has been discovered, counting the water entrances paired with the ZR ones
+u8   Entrance_IsDiscovered(s16 index);
+/// Searches for the shortest known routes from where the player is to every route node
+void Entrance_UpdateRoutes(void);
+/// Returns the node the last search started from, or ROUTE_NODE_NONE if the player's location wasn't known
+u16  Entrance_GetRouteStartNode(void);
+u8   Entrance_IsRouteNodeReachable(u16 node);
+/// Fills in the nodes on the route to the destination, starting with the player's node, and returns how many there are
+u16  Entrance_GetRoute(u16 destNode, u16* route, u16 maxLength);
 
 #endif //_ENTRANCE_H_
@@ -0,0 +1,19 @@
+#ifndef _EXTENDED_ITEMS_H_
+#define _EXTENDED_ITEMS_H_
+
+// Item ids from 0x100 up are ours, so new kinds of items never collide with a vanilla get item id.
+// Their rows live in a separate table in item_table.c, indexed by (id - EXTENDED_ITEM_ID_BASE).
+// Shared with the generator, so only plain C goes in here.
+
+#define EXTENDED_ITEM_ID_BASE 0x100
+
+typedef enum {
+    GI_EXT_MULTIWORLD_ITEM = EXTENDED_ITEM_ID_BASE, // Placeholder for an item that belongs to another multiworld player
+    GI_EXT_MAX,
+} ExtendedItemId;
+
+#define EXTENDED_ITEM_COUNT (GI_EXT_MAX - EXTENDED_ITEM_ID_BASE)
+
+#define IS_EXTENDED_ITEM_ID(itemId) ((itemId) >= EXTENDED_ITEM_ID_BASE)
+
+#endif //_EXTENDED_ITEMS_H_
@@ -16,6 +16,12 @@
 #include "draw.h"
 #include "input.h"
 #include "multiplayer.h"
+#include "multiplayer_spectator.h"
+#include "message.h"
+#include "hints.h"
+#include "profiler.h"
+#include "split_timer.h"
+#include "clock.h"
 
 u32 pressed;
 bool handledInput;
@@ -34,15 +40,23 @@ static s16 groupEntranceScroll = 0;
 static s8 currentEntranceGroup = 1;
 static u8 destListToggle = 0;
 
+static s16 hintLogScroll = 0;
+static u8 hintLogPageCount = 0;
+
+static u16 routeDestNode = ROUTE_NODE_NONE;
+static s16 routeScroll = 0;
+
+static s16 splitScroll = 0;
+
 static s32 curMenuIdx = 0;
 static bool showingLegend = false;
-static u64 lastTick = 0;
-static u64 ticksElapsed = 0;
-static bool isAsleep = false;
 
 DungeonInfo rDungeonInfoData[10];
 
-#define MAX_TICK_DELTA (TICKS_PER_SEC * 3)
+#define MENU_NETWORK_INTERVAL_MS 50
+#define SYNC_MENU_POLL_NS (16 * 1000 * 1000LL)
+#define SYNC_REQUEST_RESEND_TICKS (TICKS_PER_SEC / 4)
+#define SPECTATOR_PLAYER_LINES 8
 
 static s8 spoilerGroupDungeonIds[] = {
     -1,
@@ -119,6 +133,12 @@ static char* spoilerEntranceGroupNames[] = {
     "Hyrule Castle",
 };
 
+static char* spoilerItemCategoryNames[] = {
+    "Major Items",
+    "Songs",
+    "Keys",
+};
+
 #define UP_ARROW_CHR 24
 #define DOWN_ARROW_CHR 25
 #define LEFT_ARROW_CHR 27
@@ -146,6 +166,8 @@ static char* spoilerEntranceGroupNames[] = {
 #define COLOR_BUTTON_X          RGB8(0x32, 0x7D, 0xFE)
 #define COLOR_BUTTON_Y          RGB8(0x00, 0xD0, 0x98)
 
+#define COLOR_HINT_LIGHT_BLUE   RGB8(0x8C, 0xD2, 0xFF)
+
 typedef enum {
     PAGE_SEEDHASH,
     PAGE_DUNGEONITEMS,
@@ -155,36 +177,59 @@ typedef enum {
     PAGE_ITEMTRACKER_GROUPS,
     PAGE_ENTRANCETRACKER_ALL,
     PAGE_ENTRANCETRACKER_GROUPS,
+    PAGE_ENTRANCEROUTE,
+    PAGE_HINTLOG,
+    PAGE_SPLITS,
     PAGE_OPTIONS,
+#ifdef ENABLE_DEBUG
+    PAGE_PROFILER,
+#endif
 } GfxPage;
 
+typedef enum {
+    TRACKER_FILTER_NONE,
+    TRACKER_FILTER_HINT_REGION,
+    TRACKER_FILTER_ITEM_CATEGORY,
+    TRACKER_FILTER_SCENE,
+    TRACKER_FILTER_COUNT,
+} TrackerFilter;
+
+// The all-items tracker shows this list of item locations, which is only rebuilt when the menu
+// opens or the filter changes, using the index lists from the spoiler data
+static TrackerFilter trackerFilter = TRACKER_FILTER_NONE;
+static u16 trackerFilterIndex = 0; // Hint region or item category being shown
+static bool trackerHideCollected = false;
+static u16 trackerView[SPOILER_ITEMS_MAX];
+static u16 trackerViewCount = 0;
+static u16 trackerCompleteItems = 0;
+static u16 trackerCollectableItems = 0;
+
+// Indices into the spoiler data hints of the ones that have been read, rebuilt when the menu opens
+static u8 hintLogView[SPOILER_HINTS_MAX];
+static u8 hintLogViewCount = 0;
+
+// Split timer events that have happened, in the order they happened in, rebuilt when the menu opens
+static u8 splitView[SPLIT_COUNT];
+static u8 splitViewCount = 0;
+
+typedef enum {
+    HINT_TOKEN_END,
+    HINT_TOKEN_CHAR,
+    HINT_TOKEN_NEWLINE,
+    HINT_TOKEN_COLOR,
+    HINT_TOKEN_SKIP,
+} HintTextToken;
+
 static u32 entranceTypeToColor[] = { COLOR_GREEN, COLOR_BLUE, COLOR_ORANGE, COLOR_PINK };
 
 void Gfx_SleepQueryCallback(void)
 {
-    ticksElapsed = 0;
-    isAsleep = true;
+    Clock_OnSleep();
 }
 
 void Gfx_AwakeCallback(void)
 {
-    ticksElapsed = 0;
-    lastTick = svcGetSystemTick();
-    isAsleep = false;
-}
-
-static bool IsEntranceDiscovered(s16 index) {
-    bool isDiscovered = SaveFile_GetIsEntranceDiscovered(index);
-    if (!isDiscovered) {
-        // If the pair included one of the hyrule field <-> zora's river entrances,
-        // the randomizer will have also overriden the water-based entrances, so check those too
-        if ((index == 0x00EA && SaveFile_GetIsEntranceDiscovered(0x01D9)) || (index == 0x01D9 && SaveFile_GetIsEntranceDiscovered(0x00EA))) {
-            isDiscovered = true;
-        } else if ((index == 0x0181 && SaveFile_GetIsEntranceDiscovered(0x0311)) || (index == 0x0311 && SaveFile_GetIsEntranceDiscovered(0x0181))) {
-            isDiscovered = true;
-        }
-    }
-    return isDiscovered;
+    Clock_OnAwake();
 }
 
 static bool IsDungeonDiscovered(DungeonId dungeonId) {
@@ -210,6 +255,93 @@ static bool CanShowSpoilerGroup(SpoilerCollectionCheckGroup group) {
     return dungeonId == -1 || IsDungeonDiscovered(dungeonId);
 }
 
+static bool IsItemLocationUncollectable(u16 itemIndex) {
+    return gSpoilerData.ItemLocations[itemIndex].CollectType == COLLECTTYPE_NEVER ||
+        (gSpoilerData.ItemLocations[itemIndex].CollectType == COLLECTTYPE_REPEATABLE && SpoilerData_GetIsItemLocationRevealed(itemIndex));
+}
+
+static void Gfx_UpdateTrackerView(void) {
+    const u16* itemLocations = NULL;
+    u16 itemCount = 0;
+    switch (trackerFilter) {
+        case TRACKER_FILTER_HINT_REGION:
+            itemLocations = &gSpoilerData.HintRegionItemLocations[gSpoilerData.HintRegionOffsets[trackerFilterIndex]];
+            itemCount = gSpoilerData.HintRegionItemCounts[trackerFilterIndex];
+            break;
+        case TRACKER_FILTER_ITEM_CATEGORY:
+            itemLocations = &gSpoilerData.CategoryItemLocations[gSpoilerData.CategoryOffsets[trackerFilterIndex]];
+            itemCount = gSpoilerData.CategoryItemCounts[trackerFilterIndex];
+            break;
+        case TRACKER_FILTER_SCENE:
+            if (gGlobalContext->sceneNum < SPOILER_SCENES_MAX) {
+                itemLocations = &gSpoilerData.SceneItemLocations[gSpoilerData.SceneOffsets[gGlobalContext->sceneNum]];
+                itemCount = gSpoilerData.SceneItemCounts[gGlobalContext->sceneNum];
+            }
+            break;
+        default:
+            itemCount = gSpoilerData.ItemLocationsCount;
+            break;
+    }
+
+    trackerViewCount = 0;
+    trackerCompleteItems = 0;
+    trackerCollectableItems = 0;
+    for (u16 i = 0; i < itemCount; ++i) {
+        u16 itemIndex = itemLocations != NULL ? itemLocations[i] : i;
+        bool isCollected = SpoilerData_GetIsItemLocationCollected(itemIndex);
+        // Listing a location under an item category tells what it holds, so only do that once the item can be seen
+        if (trackerFilter == TRACKER_FILTER_ITEM_CATEGORY && !isCollected &&
+            !(CanShowSpoilerGroup(gSpoilerData.ItemLocations[itemIndex].Group) && SpoilerData_GetIsItemLocationRevealed(itemIndex))) {
+            continue;
+        }
+        bool isUncollectable = !isCollected && IsItemLocationUncollectable(itemIndex);
+        if (isCollected) {
+            trackerCompleteItems++;
+        }
+        if (!isUncollectable) {
+            trackerCollectableItems++;
+        }
+        if (trackerHideCollected && (isCollected || isUncollectable)) {
+            continue;
+        }
+        trackerView[trackerViewCount++] = itemIndex;
+    }
+
+    s16 maxScroll = trackerViewCount > MAX_ENTRY_LINES ? trackerViewCount - MAX_ENTRY_LINES : 0;
+    if (allItemsScroll > maxScroll) {
+        allItemsScroll = maxScroll;
+    }
+}
+
+static const char* Gfx_GetTrackerFilterName(void) {
+    switch (trackerFilter) {
+        case TRACKER_FILTER_HINT_REGION:
+            return &gSpoilerData.StringData[gSpoilerData.HintRegionNameOffsets[trackerFilterIndex]];
+        case TRACKER_FILTER_ITEM_CATEGORY:
+            return spoilerItemCategoryNames[trackerFilterIndex];
+        case TRACKER_FILTER_SCENE:
+            return "Current Area";
+        default:
+            return spoilerCollectionGroupNames[0];
+    }
+}
+
+static void NextTrackerFilter(void) {
+    allItemsScroll = 0;
+    trackerFilterIndex = 0;
+    do {
+        trackerFilter = (trackerFilter + 1) % TRACKER_FILTER_COUNT;
+    } while (trackerFilter == TRACKER_FILTER_HINT_REGION && gSpoilerData.HintRegionCount == 0);
+    Gfx_UpdateTrackerView();
+}
+
+static void ChangeTrackerFilterIndex(s8 delta) {
+    u16 count = trackerFilter == TRACKER_FILTER_HINT_REGION ? gSpoilerData.HintRegionCount : SPOILER_ITEM_CATEGORY_COUNT;
+    allItemsScroll = 0;
+    trackerFilterIndex = (trackerFilterIndex + count + delta) % count;
+    Gfx_UpdateTrackerView();
+}
+
 static void Gfx_DrawScrollBar(u16 barX, u16 barY, u16 barSize, u16 currentScroll, u16 maxScroll, u16 pageSize) {
     Draw_DrawRect(barX, barY, SCROLL_BAR_THICKNESS, barSize, COLOR_SCROLL_BAR_BG);
 
@@ -277,7 +409,8 @@ static void Gfx_DrawButtonPrompts(void) {
         Draw_DrawString(22, textY, COLOR_TITLE, "Browse spoiler log");
     } else if (curMenuIdx >= PAGE_ITEMTRACKER_ALL && curMenuIdx <= PAGE_ENTRANCETRACKER_GROUPS) {
         Draw_DrawIcon(10, promptY, COLOR_WHITE, ICON_BUTTON_DPAD);
-        Draw_DrawString(22, textY, COLOR_TITLE, "Browse entries");
+        // Shorter prompt on the all-items page, to fit the filter buttons
+        Draw_DrawString(22, textY, COLOR_TITLE, curMenuIdx == PAGE_ITEMTRACKER_ALL ? "Browse" : "Browse entries");
         static const u8 offsetX = 114;
         if (curMenuIdx == PAGE_ITEMTRACKER_GROUPS || curMenuIdx == PAGE_ENTRANCETRACKER_GROUPS) {
             Draw_DrawIcon(offsetX, promptY, COLOR_BUTTON_Y, ICON_BUTTON_Y);
@@ -290,36 +423,32 @@ static void Gfx_DrawButtonPrompts(void) {
                 const char* destToggleString = destListToggle ? "Dest" : "Src";
                 Draw_DrawString(toggleOffsetX + 12, textY, COLOR_TITLE, destToggleString);
             }
-        } else if (curMenuIdx == PAGE_ITEMTRACKER_ALL || curMenuIdx == PAGE_ENTRANCETRACKER_ALL) {
+        } else if (curMenuIdx == PAGE_ITEMTRACKER_ALL) {
+            Draw_DrawIcon(66, promptY, COLOR_BUTTON_A, ICON_BUTTON_A);
+            Draw_DrawString(78, textY, COLOR_TITLE, "Legend");
+            Draw_DrawIcon(122, promptY, COLOR_BUTTON_X, ICON_BUTTON_X);
+            Draw_DrawString(134, textY, COLOR_TITLE, "Filter");
+            Draw_DrawIcon(178, promptY, COLOR_BUTTON_Y, ICON_BUTTON_Y);
+            Draw_DrawString(190, textY, COLOR_TITLE, trackerHideCollected ? "Show found" : "Hide found");
+        } else if (curMenuIdx == PAGE_ENTRANCETRACKER_ALL) {
             Draw_DrawIcon(offsetX, promptY, COLOR_BUTTON_A, ICON_BUTTON_A);
             Draw_DrawString(offsetX + 12, textY, COLOR_TITLE, "Toggle Legend");
         }
+    } else if (curMenuIdx == PAGE_ENTRANCEROUTE) {
+        Draw_DrawIcon(10, promptY, COLOR_WHITE, ICON_BUTTON_DPAD);
+        Draw_DrawString(22, textY, COLOR_TITLE, "Change destination / scroll route");
+    } else if (curMenuIdx == PAGE_HINTLOG) {
+        Draw_DrawIcon(10, promptY, COLOR_WHITE, ICON_BUTTON_DPAD);
+        Draw_DrawString(22, textY, COLOR_TITLE, "Browse hints");
+    } else if (curMenuIdx == PAGE_SPLITS) {
+        Draw_DrawIcon(10, promptY, COLOR_WHITE, ICON_BUTTON_DPAD);
+        Draw_DrawString(22, textY, COLOR_TITLE, "Browse splits");
     } else if (curMenuIdx == PAGE_OPTIONS) {
         Draw_DrawIcon(10, promptY, COLOR_WHITE, ICON_BUTTON_DPAD);
         Draw_DrawString(22, textY, COLOR_TITLE, "Select / change options");
     }
 }
 
-static void Gfx_UpdatePlayTime(void)
-{
-    u64 currentTick = svcGetSystemTick();
-    if (!isAsleep && IsInGame()) {
-        ticksElapsed += currentTick - lastTick;
-        if (ticksElapsed > MAX_TICK_DELTA) {
-            // Assume that if more ticks than MAX_TICK_DELTA have passed, it has been a long
-            // time since we last checked, which means the the system may have been asleep or the home button pressed.
-            // Reset the timer so we don't artificially inflate the play time.
-            ticksElapsed = 0;
-        } else {
-            while (ticksElapsed >= TICKS_PER_SEC) {
-                ticksElapsed -= TICKS_PER_SEC;
-                ++gExtSaveData.playtimeSeconds;
-            }
-        }
-    }
-    lastTick = currentTick;
-}
-
 static void Gfx_DrawSeedHash(void) {
     u8 offsetY = 0;
     Draw_DrawFormattedString(10, 16 + (SPACING_Y * offsetY++), COLOR_TITLE, "Seed Hash:");
@@ -337,6 +466,10 @@ static void Gfx_DrawSeedHash(void) {
 
     if (gSettingsContext.mp_Enabled) {
         Draw_DrawFormattedString(10, 16 + (SPACING_Y * offsetY++), COLOR_TITLE, "Multiplayer:");
+        MultiplayerStatus status = Multiplayer_GetStatus();
+        Draw_DrawFormattedString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++),
+            status == MP_STATUS_CONNECTED ? COLOR_GREEN : (status == MP_STATUS_OFFLINE ? COLOR_RED : COLOR_WHITE),
+            "Status: %s", status == MP_STATUS_CONNECTED ? "Connected" : (status == MP_STATUS_OFFLINE ? "Offline" : "Connecting..."));
         s16 playerCount = Multiplayer_PlayerCount();
         if (playerCount >= 0) {
             Draw_DrawFormattedString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Connected players: %d", playerCount);
@@ -346,9 +479,23 @@ static void Gfx_DrawSeedHash(void) {
         Draw_DrawFormattedString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Received packets: %d", mp_receivedPackets);
         if (gSettingsContext.mp_SharedProgress) {
             Draw_DrawFormattedString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Sync ID: %d", gSettingsContext.mp_SyncId);
+            Draw_DrawFormattedString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Updates waiting for menu close: %d", mp_menuQueuedPackets);
         }
         offsetY++;
     }
+
+    if (gSpoilerData.TruncatedSections != 0) {
+        Draw_DrawString(10, 16 + (SPACING_Y * offsetY++), COLOR_TITLE, "Didn't fit in the spoiler data:");
+        if (gSpoilerData.TruncatedSections & SPOILER_TRUNCATED_HINT_REGIONS) {
+            Draw_DrawString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Some hint regions");
+        }
+        if (gSpoilerData.TruncatedSections & SPOILER_TRUNCATED_HINTS) {
+            Draw_DrawString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Some gossip stones for the hint log");
+        }
+        if (gSpoilerData.TruncatedSections & SPOILER_TRUNCATED_ROUTES) {
+            Draw_DrawString(10 + (SPACING_X * 4), 16 + (SPACING_Y * offsetY++), COLOR_WHITE, "Entrance routes");
+        }
+    }
 }
 
 static void Gfx_DrawDungeonItems(void) {
@@ -529,23 +676,27 @@ static void Gfx_DrawItemTracker(void) {
         return;
     }
 
-    u16 itemCount = ViewingGroups() ? gSpoilerData.GroupItemCounts[currentItemGroup] : gSpoilerData.ItemLocationsCount;
+    u16 itemCount = ViewingGroups() ? gSpoilerData.GroupItemCounts[currentItemGroup] : trackerViewCount;
     u16 startIndex = ViewingGroups() ? gSpoilerData.GroupOffsets[currentItemGroup] : 0;
     s16* itemScroll = ViewingGroups() ? &groupItemsScroll : &allItemsScroll;
 
-    // Gather up completed items to calculate how far along this group is
-    u16 completeItems = 0;
-    u16 uncollectableItems = 0;
-    for (u32 i = 0; i < itemCount; ++i) {
-        u32 locIndex = i + startIndex;
-        if (SpoilerData_GetIsItemLocationCollected(locIndex)) {
-            completeItems++;
-        } else if (gSpoilerData.ItemLocations[locIndex].CollectType == COLLECTTYPE_NEVER ||
-            (gSpoilerData.ItemLocations[locIndex].CollectType == COLLECTTYPE_REPEATABLE && SpoilerData_GetIsItemLocationRevealed(locIndex))) {
-            uncollectableItems++;
+    // Gather up completed items to calculate how far along this group is.
+    // The filtered list already counted them when it was built.
+    u16 completeItems = trackerCompleteItems;
+    u16 collectableItems = trackerCollectableItems;
+    if (ViewingGroups()) {
+        u16 uncollectableItems = 0;
+        completeItems = 0;
+        for (u32 i = 0; i < itemCount; ++i) {
+            u32 locIndex = i + startIndex;
+            if (SpoilerData_GetIsItemLocationCollected(locIndex)) {
+                completeItems++;
+            } else if (IsItemLocationUncollectable(locIndex)) {
+                uncollectableItems++;
+            }
         }
+        collectableItems = itemCount - uncollectableItems;
     }
-    u16 collectableItems = itemCount - uncollectableItems;
     float groupPercent = ((float)completeItems / (float)collectableItems) * 100.0f;
     Draw_DrawFormattedString(SCREEN_BOT_WIDTH - 10 - (SPACING_X * 6), 16, completeItems == collectableItems ? COLOR_GREEN : COLOR_WHITE, "%5.1f%%", groupPercent);
 
@@ -553,27 +704,20 @@ static void Gfx_DrawItemTracker(void) {
     u16 lastItem = *itemScroll + MAX_ENTRY_LINES;
     if (lastItem > itemCount) { lastItem = itemCount; }
     Draw_DrawFormattedString(10, 16, COLOR_TITLE, "%s - (%d - %d) / %d",
-        spoilerCollectionGroupNames[ViewingGroups() ? currentItemGroup : 0], firstItem, lastItem, itemCount);
+        ViewingGroups() ? spoilerCollectionGroupNames[currentItemGroup] : Gfx_GetTrackerFilterName(), firstItem, lastItem, itemCount);
 
     u16 listTopY = 32;
-    u32 itemGroupIndex = 1; // Keep the last picked group index around to start the search from
     for (u32 item = 0; item < MAX_ENTRY_LINES; ++item) {
-        u32 locIndex = item + startIndex + *itemScroll;
         if (item >= itemCount) { break; }
+        u32 locIndex = ViewingGroups() ? item + startIndex + *itemScroll : trackerView[item + *itemScroll];
 
         u32 locPosY = listTopY + ((SPACING_SMALL_Y + 1) * item * 2);
         u32 itemPosY = locPosY + SPACING_SMALL_Y;
         bool isCollected = SpoilerData_GetIsItemLocationCollected(locIndex);
 
-        // Find this item's group index, so we can see if we should hide
+        // Check this item's group, so we can see if we should hide
         // its name because it's located in an undiscovered dungeon
-        for (u32 group = itemGroupIndex; group < SPOILER_COLLECTION_GROUP_COUNT; ++group) {
-            u16 groupOffset = gSpoilerData.GroupOffsets[group];
-            if (locIndex >= groupOffset && locIndex < groupOffset + gSpoilerData.GroupItemCounts[group]) {
-                itemGroupIndex = group;
-                break;
-            }
-        }
+        SpoilerCollectionCheckGroup itemGroupIndex = gSpoilerData.ItemLocations[locIndex].Group;
         bool canShowGroup = isCollected || CanShowSpoilerGroup(itemGroupIndex);
 
         u32 color = COLOR_WHITE;
@@ -628,7 +772,7 @@ static void Gfx_DrawEntranceTracker(void) {
         u16 discoveredEntrs = 0;
         for (u32 i = 0; i < entranceCount; ++i) {
             u32 locIndex = i + startIndex;
-            if (IsEntranceDiscovered(entranceList[locIndex].index)) {
+            if (Entrance_IsDiscovered(entranceList[locIndex].index)) {
                 ++discoveredEntrs;
             }
         }
@@ -650,7 +794,7 @@ static void Gfx_DrawEntranceTracker(void) {
         u32 locPosY = listTopY + ((SPACING_SMALL_Y + 1) * entrance * 2);
         u32 entrPosY = locPosY + SPACING_SMALL_Y;
 
-        bool isDiscovered = IsEntranceDiscovered(entranceList[locIndex].index);
+        bool isDiscovered = Entrance_IsDiscovered(entranceList[locIndex].index);
 
         u32 origSrcColor = isDiscovered ? entranceTypeToColor[GetEntranceData(entranceList[locIndex].index)->type] : COLOR_WHITE;
         u32 origDstColor = isDiscovered ? entranceTypeToColor[GetEntranceData(entranceList[locIndex].destination)->type] : COLOR_WHITE;
@@ -685,6 +829,307 @@ static void Gfx_DrawEntranceTracker(void) {
     Gfx_DrawScrollBar(SCREEN_BOT_WIDTH - 3, listTopY, SCREEN_BOT_HEIGHT - 40 - listTopY, *entranceScroll, entranceCount, MAX_ENTRY_LINES);
 }
 
+// Picks the next (or previous) destination that there's a known route to, other than where the player already is
+static void ChangeRouteDestination(s8 direction) {
+    u16 nodeCount = gSpoilerData.RouteNodeCount;
+    u16 node = routeDestNode == ROUTE_NODE_NONE ? (direction > 0 ? nodeCount - 1 : 0) : routeDestNode;
+    for (u16 i = 0; i < nodeCount; i++) {
+        node = (node + nodeCount + direction) % nodeCount;
+        if (node != Entrance_GetRouteStartNode() && Entrance_IsRouteNodeReachable(node)) {
+            routeDestNode = node;
+            routeScroll = 0;
+            return;
+        }
+    }
+    routeDestNode = ROUTE_NODE_NONE;
+}
+
+static void Gfx_UpdateRoutes(void) {
+    Entrance_UpdateRoutes();
+    // Keep the destination from last time if it can still be reached from the new location
+    if (routeDestNode == Entrance_GetRouteStartNode() || !Entrance_IsRouteNodeReachable(routeDestNode)) {
+        routeDestNode = ROUTE_NODE_NONE;
+        ChangeRouteDestination(1);
+    }
+}
+
+static void Gfx_DrawEntranceRoute(void) {
+    Draw_DrawString(10, 16, COLOR_TITLE, "Entrance Route Finder");
+    u16 startNode = Entrance_GetRouteStartNode();
+    if (startNode == ROUTE_NODE_NONE) {
+        Draw_DrawString(10, 46, COLOR_WHITE, "Current location unknown.");
+        Draw_DrawString(10, 46 + SPACING_Y, COLOR_WHITE, "Go through a loading zone and try again.");
+        return;
+    }
+
+    Draw_DrawString(10, 16 + SPACING_Y * 2, COLOR_WHITE, "From:");
+    Draw_DrawString(10 + SPACING_X * 6, 16 + SPACING_Y * 2, COLOR_GREEN,
+        &gSpoilerData.StringData[gSpoilerData.RouteNodeNameOffsets[startNode]]);
+    Draw_DrawString(10, 16 + SPACING_Y * 3, COLOR_WHITE, "To:");
+    if (routeDestNode == ROUTE_NODE_NONE) {
+        Draw_DrawString(10 + SPACING_X * 6, 16 + SPACING_Y * 3, COLOR_WHITE, "No known routes from here");
+        return;
+    }
+    Draw_DrawFormattedString(10 + SPACING_X * 6, 16 + SPACING_Y * 3, COLOR_BLUE, "%c %s %c", LEFT_ARROW_CHR,
+        &gSpoilerData.StringData[gSpoilerData.RouteNodeNameOffsets[routeDestNode]], RIGHT_ARROW_CHR);
+
+    u16 route[SPOILER_ROUTE_NODES_MAX];
+    u16 routeLength = Entrance_GetRoute(routeDestNode, route, SPOILER_ROUTE_NODES_MAX);
+    u16 listTopY = 16 + SPACING_Y * 5;
+    // The first node is where the player is, so only the places to go through are listed
+    u16 stepCount = routeLength - 1;
+    for (u16 i = 0; i < MAX_ENTRY_LINES && routeScroll + i < stepCount; i++) {
+        u16 step = routeScroll + i;
+        u16 node = route[step + 1];
+        Draw_DrawFormattedString_Small(10, listTopY + (SPACING_SMALL_Y + 2) * i, node == routeDestNode ? COLOR_BLUE : COLOR_WHITE,
+            "%2d. %s", step + 1, &gSpoilerData.StringData[gSpoilerData.RouteNodeNameOffsets[node]]);
+    }
+    Gfx_DrawScrollBar(SCREEN_BOT_WIDTH - 3, listTopY, SCREEN_BOT_HEIGHT - 40 - listTopY, routeScroll, stepCount, MAX_ENTRY_LINES);
+}
+
+static void Gfx_UpdateHintLog(void) {
+    hintLogViewCount = 0;
+    for (u16 i = 0; i < gSpoilerData.HintCount; i++) {
+        if (Hints_GetIsHintRead(gSpoilerData.Hints[i].MessageId)) {
+            hintLogView[hintLogViewCount++] = i;
+        }
+    }
+    if (hintLogScroll >= hintLogViewCount) {
+        hintLogScroll = hintLogViewCount > 0 ? hintLogViewCount - 1 : 0;
+    }
+}
+
+static void ScrollHintLog(s16 delta) {
+    hintLogScroll += delta;
+    if (hintLogScroll >= hintLogViewCount) {
+        hintLogScroll = hintLogViewCount - 1;
+    }
+    if (hintLogScroll < 0) {
+        hintLogScroll = 0;
+    }
+}
+
+// Reads the next part of a message, skipping the control codes that only matter inside a textbox
+static HintTextToken Gfx_NextHintToken(const char** cursor, const char* end, u8* value) {
+    if (*cursor >= end || **cursor == '\0') {
+        return HINT_TOKEN_END;
+    }
+    u8 c = *(*cursor)++;
+    if (c != 0x7F) {
+        *value = c;
+        return HINT_TOKEN_CHAR;
+    }
+    if (*cursor >= end) {
+        return HINT_TOKEN_END;
+    }
+
+    HintTextToken token = HINT_TOKEN_SKIP;
+    u8 argSize = 0;
+    switch (*(*cursor)++) {
+        case 0x00: // Message end
+            return HINT_TOKEN_END;
+        case 0x01: // Wait for input, the next textbox starts on a new line
+        case 0x1C: // Newline
+            token = HINT_TOKEN_NEWLINE;
+            break;
+        case 0x1D: // Color
+            token = HINT_TOKEN_COLOR;
+            argSize = 1;
+            break;
+        case 0x02: // Horizontal space
+        case 0x06: // Shop message box
+        case 0x08: // Delay frames
+        case 0x0A: // Close after
+        case 0x0F: // Item obtained
+        case 0x10: // Set speed
+            argSize = 1;
+            break;
+        case 0x03: // Go to
+            argSize = 2;
+            break;
+        case 0x1A: // Two way choice
+            argSize = 4;
+            break;
+    }
+    if (*cursor + argSize > end) {
+        return HINT_TOKEN_END;
+    }
+    if (token == HINT_TOKEN_COLOR) {
+        *value = **cursor;
+    }
+    *cursor += argSize;
+    return token;
+}
+
+static u32 Gfx_GetHintTextColor(u8 messageColor) {
+    switch (messageColor) {
+        case 0x41: return COLOR_RED;
+        case 0x42: return COLOR_GREEN;
+        case 0x43: return COLOR_BLUE;
+        case 0x44: return COLOR_HINT_LIGHT_BLUE;
+        case 0x45: return COLOR_PINK;
+        case 0x46: return COLOR_WARN;
+        case 0x47: return COLOR_LIGHT_GRAY; // Black wouldn't show up on the menu background
+        default:   return COLOR_WHITE;
+    }
+}
+
+// Draws a hint with the line breaks and colors it has in its textbox, or only counts its lines if draw is false.
+// Empty lines are left out to keep the entries short. Returns the number of lines.
+static u8 Gfx_DrawHintText(u32 posX, u32 posY, const MessageLanguageInfo* text, bool draw) {
+    const u32 maxColumns = (SCREEN_BOT_WIDTH - posX) / SPACING_SMALL_X;
+    const char* cursor = text->offset;
+    const char* end = text->offset + text->length;
+    char segment[64];
+    u8 segmentLength = 0;
+    u32 segmentColumn = 0;
+    u32 column = 0;
+    u32 color = COLOR_WHITE;
+    u8 lines = 0;
+    u8 value = 0;
+    HintTextToken token;
+
+    do {
+        token = Gfx_NextHintToken(&cursor, end, &value);
+        bool printable = token == HINT_TOKEN_CHAR && column < maxColumns && segmentLength < sizeof(segment) - 1;
+        // Draw what's been collected so far once the line or color changes
+        if (!printable && segmentLength > 0) {
+            if (draw) {
+                segment[segmentLength] = '\0';
+                Draw_DrawString_Small(posX + segmentColumn * SPACING_SMALL_X, posY + lines * SPACING_SMALL_Y, color, segment);
+            }
+            segmentLength = 0;
+            segmentColumn = column;
+        }
+
+        if (token == HINT_TOKEN_CHAR && column < maxColumns) {
+            if (segmentLength == 0) {
+                segmentColumn = column;
+            }
+            segment[segmentLength++] = (value >= ' ' && value < 0x7F) ? value : '?';
+            column++;
+        } else if (token == HINT_TOKEN_NEWLINE && column > 0) {
+            lines++;
+            column = 0;
+        } else if (token == HINT_TOKEN_COLOR) {
+            color = Gfx_GetHintTextColor(value);
+        }
+    } while (token != HINT_TOKEN_END);
+
+    return column > 0 ? lines + 1 : lines;
+}
+
+static void Gfx_DrawHintLog(void) {
+    Draw_DrawFormattedString(10, 16, COLOR_TITLE, "Hint Log - %d / %d read", hintLogViewCount, gSpoilerData.HintCount);
+    if (hintLogViewCount == 0) {
+        Draw_DrawString(10, 46, COLOR_WHITE, "No hints read yet!");
+        return;
+    }
+
+    MessageLanguage language = gSettingsContext.region == REGION_NA ? ENGLISH_U : ENGLISH_E;
+    u16 listTopY = 32;
+    u16 listBottomY = SCREEN_BOT_HEIGHT - 20;
+    u16 posY = listTopY;
+    // Only the hints that fit on the page are looked up and drawn, starting from the scroll position
+    hintLogPageCount = 0;
+    for (u16 i = hintLogScroll; i < hintLogViewCount; i++) {
+        const SpoilerHint* hint = &gSpoilerData.Hints[hintLogView[i]];
+        const MessageEntry* entry = Message_FindCustomEntry(hint->MessageId);
+        if (entry == NULL) {
+            continue;
+        }
+
+        const MessageLanguageInfo* text = &entry->info[language];
+        u32 textX = 10 + (SPACING_SMALL_X * 2);
+        u16 entryHeight = SPACING_SMALL_Y * (1 + Gfx_DrawHintText(textX, 0, text, false)) + 4;
+        if (posY + entryHeight > listBottomY && hintLogPageCount > 0) {
+            break;
+        }
+
+        Draw_DrawString_Small(10, posY, COLOR_TITLE, &gSpoilerData.StringData[hint->StoneStrOffset]);
+        Gfx_DrawHintText(textX, posY + SPACING_SMALL_Y, text, true);
+        posY += entryHeight;
+        hintLogPageCount++;
+    }
+
+    if (hintLogViewCount > hintLogPageCount) {
+        // The scroll position goes up to the last hint, so count the page in the total to keep the thumb inside the bar
+        Gfx_DrawScrollBar(SCREEN_BOT_WIDTH - 3, listTopY, listBottomY - listTopY, hintLogScroll,
+            hintLogViewCount - 1 + hintLogPageCount, hintLogPageCount);
+    }
+}
+
+static void Gfx_UpdateSplits(void) {
+    // Insertion sort by time, there are only a few dozen events and the list is mostly in order already
+    splitViewCount = 0;
+    for (u8 event = 0; event < SPLIT_COUNT; event++) {
+        u32 time = SplitTimer_GetTime(event);
+        if (time == 0) {
+            continue;
+        }
+        u8 pos = splitViewCount++;
+        while (pos > 0 && SplitTimer_GetTime(splitView[pos - 1]) > time) {
+            splitView[pos] = splitView[pos - 1];
+            pos--;
+        }
+        splitView[pos] = event;
+    }
+    if (splitScroll > 0 && splitScroll + MAX_ENTRY_LINES > splitViewCount) {
+        splitScroll = splitViewCount > MAX_ENTRY_LINES ? splitViewCount - MAX_ENTRY_LINES : 0;
+    }
+}
+
+static void Gfx_DrawTime(u32 posX, u32 posY, u32 color, u32 time) {
+    Draw_DrawFormattedString_Small(posX, posY, color, "%2u:%02u:%02u", time / 3600, (time / 60) % 60, time % 60);
+}
+
+static void Gfx_DrawGoal(u32 posY, const char* label, const SplitTimerGoal* goal) {
+    u8 remaining = goal->have >= goal->need ? 0 : goal->need - goal->have;
+    Draw_DrawFormattedString_Small(10, posY, remaining == 0 ? COLOR_GREEN : COLOR_WHITE, "%s: %d / %d %s (%d left)",
+        label, goal->have, goal->need, goal->unit, remaining);
+}
+
+static void Gfx_DrawSplits(void) {
+    Draw_DrawString(10, 16, COLOR_TITLE, "Split Timer");
+    u32 playtime = gExtSaveData.playtimeSeconds;
+    Draw_DrawFormattedString(SCREEN_BOT_WIDTH - 10 - (SPACING_X * 8), 16, COLOR_WHITE, "%02u:%02u:%02u",
+        playtime / 3600, (playtime / 60) % 60, playtime % 60);
+
+    u16 posY = 16 + SPACING_Y + 4;
+    SplitTimerGoal goal;
+    if (SplitTimer_GetBridgeGoal(&goal)) {
+        Gfx_DrawGoal(posY, "Bridge", &goal);
+        posY += SPACING_SMALL_Y + 2;
+    }
+    if (SplitTimer_GetLACSGoal(&goal)) {
+        Gfx_DrawGoal(posY, "Ganon's Boss Key", &goal);
+        posY += SPACING_SMALL_Y + 2;
+    }
+
+    u16 listTopY = 16 + SPACING_Y * 4;
+    if (splitViewCount == 0) {
+        Draw_DrawString(10, listTopY, COLOR_WHITE, "No splits yet!");
+        return;
+    }
+
+    for (u16 i = 0; i < MAX_ENTRY_LINES && splitScroll + i < splitViewCount; i++) {
+        u8 event = splitView[splitScroll + i];
+        u16 entryY = listTopY + (SPACING_SMALL_Y + 2) * i;
+        Gfx_DrawTime(10, entryY, COLOR_WHITE, SplitTimer_GetTime(event));
+        u32 nameX = 10 + SPACING_SMALL_X * 10;
+        if (event < SPLIT_REWARD) {
+            Draw_DrawFormattedString_Small(nameX, entryY, COLOR_WHITE, "Entered %s", DungeonNames[event - SPLIT_DUNGEON_ENTERED]);
+        } else if (event < SPLIT_BOSS_KEY) {
+            Draw_DrawString_Small(nameX, entryY, COLOR_HINT_LIGHT_BLUE, DungeonRewardNames[event - SPLIT_REWARD]);
+        } else if (event < SPLIT_GANON_DEFEATED) {
+            Draw_DrawFormattedString_Small(nameX, entryY, COLOR_ORANGE, "%s Boss Key", DungeonNames[event - SPLIT_BOSS_KEY]);
+        } else {
+            Draw_DrawString_Small(nameX, entryY, COLOR_GREEN, "Ganon defeated");
+        }
+    }
+    Gfx_DrawScrollBar(SCREEN_BOT_WIDTH - 3, listTopY, SCREEN_BOT_HEIGHT - 40 - listTopY, splitScroll, splitViewCount, MAX_ENTRY_LINES);
+}
+
 static void (*menu_draw_funcs[])(void) = {
     // Make sure these line up with the GfxPage enum above
     Gfx_DrawSeedHash,
@@ -695,7 +1140,13 @@ static void (*menu_draw_funcs[])(void) = {
     Gfx_DrawItemTracker, // Groups
     Gfx_DrawEntranceTracker, // All
     Gfx_DrawEntranceTracker, // Groups
+    Gfx_DrawEntranceRoute,
+    Gfx_DrawHintLog,
+    Gfx_DrawSplits,
     Gfx_DrawOptions,
+#ifdef ENABLE_DEBUG
+    Profiler_Draw,
+#endif
 };
 
 static void Gfx_DrawHeader() {
@@ -734,13 +1185,25 @@ static s16 Gfx_Scroll(s16 current, s16 scrollDelta, u16 itemCount) {
 
 static void Gfx_ShowMenu(void) {
     pressed = 0;
+    Input_Reset();
+    // Collected checks, hints read and the current scene may have changed since the menu was last open
+    Gfx_UpdateTrackerView();
+    Gfx_UpdateHintLog();
+    Gfx_UpdateSplits();
+    if (menu_draw_funcs[PAGE_ENTRANCEROUTE] != NULL) {
+        Gfx_UpdateRoutes();
+    }
+#ifdef ENABLE_DEBUG
+    // The game is paused while the menu is open, so writing the spikes here doesn't cause new ones
+    Profiler_SaveSpikes();
+#endif
 
     Draw_ClearFramebuffer();
     if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
 
     do {
         // End the loop if the system has gone to sleep, so the game can properly respond
-        if (isAsleep) {
+        if (Clock_IsAsleep()) {
             break;
         }
 
@@ -784,8 +1247,21 @@ static void Gfx_ShowMenu(void) {
                 showingLegend = !showingLegend;
                 handledInput = true;
             } else if (!showingLegend) {
-                u16 itemCount = gSpoilerData.ItemLocationsCount;
-                if (pressed & BUTTON_LEFT) {
+                u16 itemCount = trackerViewCount;
+                bool choosingFilter = trackerFilter == TRACKER_FILTER_HINT_REGION || trackerFilter == TRACKER_FILTER_ITEM_CATEGORY;
+                if (pressed & BUTTON_X) {
+                    NextTrackerFilter();
+                    handledInput = true;
+                } else if (pressed & BUTTON_Y) {
+                    trackerHideCollected = !trackerHideCollected;
+                    allItemsScroll = 0;
+                    Gfx_UpdateTrackerView();
+                    handledInput = true;
+                } else if (choosingFilter && (pressed & (BUTTON_LEFT | BUTTON_RIGHT))) {
+                    // Left and right pick the hint region or item category instead of paging through the list
+                    ChangeTrackerFilterIndex((pressed & BUTTON_RIGHT) ? 1 : -1);
+                    handledInput = true;
+                } else if (pressed & BUTTON_LEFT) {
                     allItemsScroll = Gfx_Scroll(allItemsScroll, -MAX_ENTRY_LINES * 10, itemCount);
                     handledInput = true;
                 } else if (pressed & BUTTON_RIGHT) {
@@ -867,6 +1343,50 @@ static void Gfx_ShowMenu(void) {
                 destListToggle = !destListToggle;
                 handledInput = true;
             }
+        } else if (curMenuIdx == PAGE_ENTRANCEROUTE && routeDestNode != ROUTE_NODE_NONE) {
+            u16 route[SPOILER_ROUTE_NODES_MAX];
+            u16 stepCount = Entrance_GetRoute(routeDestNode, route, SPOILER_ROUTE_NODES_MAX) - 1;
+            if (pressed & BUTTON_RIGHT) {
+                ChangeRouteDestination(1);
+                handledInput = true;
+            } else if (pressed & BUTTON_LEFT) {
+                ChangeRouteDestination(-1);
+                handledInput = true;
+            } else if (pressed & BUTTON_DOWN) {
+                routeScroll = Gfx_Scroll(routeScroll, 1, stepCount);
+                handledInput = true;
+            } else if (pressed & BUTTON_UP) {
+                routeScroll = Gfx_Scroll(routeScroll, -1, stepCount);
+                handledInput = true;
+            }
+        } else if (curMenuIdx == PAGE_HINTLOG && hintLogViewCount > 0) {
+            if (pressed & BUTTON_UP) {
+                ScrollHintLog(-1);
+                handledInput = true;
+            } else if (pressed & BUTTON_DOWN) {
+                ScrollHintLog(1);
+                handledInput = true;
+            } else if (pressed & BUTTON_LEFT) {
+                ScrollHintLog(-hintLogPageCount);
+                handledInput = true;
+            } else if (pressed & BUTTON_RIGHT) {
+                ScrollHintLog(hintLogPageCount);
+                handledInput = true;
+            }
+        } else if (curMenuIdx == PAGE_SPLITS && splitViewCount > 0) {
+            if (pressed & BUTTON_DOWN) {
+                splitScroll = Gfx_Scroll(splitScroll, 1, splitViewCount);
+                handledInput = true;
+            } else if (pressed & BUTTON_UP) {
+                splitScroll = Gfx_Scroll(splitScroll, -1, splitViewCount);
+                handledInput = true;
+            } else if (pressed & BUTTON_RIGHT) {
+                splitScroll = Gfx_Scroll(splitScroll, MAX_ENTRY_LINES, splitViewCount);
+                handledInput = true;
+            } else if (pressed & BUTTON_LEFT) {
+                splitScroll = Gfx_Scroll(splitScroll, -MAX_ENTRY_LINES, splitViewCount);
+                handledInput = true;
+            }
         } else if (curMenuIdx == PAGE_OPTIONS) {
             Gfx_OptionsUpdate();
         }
@@ -905,7 +1425,7 @@ static void Gfx_ShowMenu(void) {
         Draw_ClearBackbuffer();
 
         // Continue counting up play time while in the in-game menu
-        Gfx_UpdatePlayTime();
+        Clock_Update();
 
         menu_draw_funcs[curMenuIdx]();
         Gfx_DrawButtonPrompts();
@@ -913,79 +1433,261 @@ static void Gfx_ShowMenu(void) {
         Draw_CopyBackBuffer();
         if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
 
-        pressed = Input_WaitWithTimeout(1000, closingButton);
+        // Wait up to a second for input, but keep pulling packets in short steps so the
+        // receive buffer doesn't fill up while the menu is open
+        u32 waitedMs = 0;
+        do {
+            pressed = Input_WaitWithTimeout(MENU_NETWORK_INTERVAL_MS);
+            waitedMs += MENU_NETWORK_INTERVAL_MS;
+            Multiplayer_ReceivePackets();
+        } while (pressed == 0 && waitedMs < 1000 && !Clock_IsAsleep());
 
     } while(true);
 }
 
+static void Gfx_DrawSyncProgress(u8 neededMask) {
+    Draw_ClearBackbuffer();
+
+    u8 offsetY = 1;
+    const char* titleString = mp_foundSyncer ? "Syncing..." : "Looking for syncer...";
+    Draw_DrawString(SCREEN_BOT_WIDTH / 2 - (strlen(titleString) / 2) * SPACING_X, 16 + SPACING_Y * offsetY++, COLOR_WHITE, titleString);
+
+    if (mp_foundSyncer) {
+        offsetY++;
+        static const char* syncPacketNames[] = { "Base Sync", "Save Scene Flags 1", "Save Scene Flags 2", "Save Scene Flags 3", "Save Scene Flags 4", "Entrance Data" };
+        static const u8 squareSize = 9;
+        for (size_t i = 0; i < ARRAY_SIZE(mp_completeSyncs); i++) {
+            Draw_DrawRect(10, 16 + SPACING_Y * offsetY, squareSize, squareSize, COLOR_WHITE);
+            Draw_DrawRect(11, 17 + SPACING_Y * offsetY, squareSize - 2, squareSize - 2, (neededMask & (1 << i)) ? COLOR_BLACK : COLOR_GREEN);
+            Draw_DrawString(10 + SPACING_X * 2, 16 + SPACING_Y * offsetY++, COLOR_WHITE, syncPacketNames[i]);
+        }
+    }
+}
+
 static void Gfx_ShowMultiplayerSyncMenu(void) {
     Draw_ClearFramebuffer();
     if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
 
+    u64 startTicks = Clock_GetTicks();
+    u64 lastUpdateTicks = 0;
+    u64 lastRequestTicks = 0;
+    u8 lastRequestMask = 0xFF;
+    u8 drawnMask = 0xFF;
+    bool drawnFoundSyncer = false;
+
     do {
         // End the loop if the system has gone to sleep, so the game can properly respond
-        if (isAsleep) {
+        if (Clock_IsAsleep()) {
             break;
         }
 
-        Draw_ClearBackbuffer();
+        // Packets are pulled every poll so each answer is handled as soon as it arrives,
+        // the ghost ping only needs to go out once a second
+        Clock_Update();
+        u64 ticks = Clock_GetTicks();
+        if (ticks - lastUpdateTicks >= TICKS_PER_SEC) {
+            Multiplayer_Update(0);
+            lastUpdateTicks = ticks;
+        } else {
+            Multiplayer_ReceivePackets();
+        }
 
-        Multiplayer_Update(0);
+        u8 neededMask = mp_foundSyncer ? Multiplayer_GetNeededPacketsMask() : 0;
+
+        if (mp_foundSyncer && neededMask == 0) {
+            // Syncing is done!
+            Gfx_DrawSyncProgress(neededMask);
+            const char* msgString = "Done!";
+            Draw_DrawString(SCREEN_BOT_WIDTH / 2 - (strlen(msgString) / 2) * SPACING_X, 16 + SPACING_Y * (4 + ARRAY_SIZE(mp_completeSyncs)), COLOR_WHITE, msgString);
+            Draw_CopyBackBuffer();
+            svcSleepThread(1000 * 1000 * 1000LL);
+
+            Draw_ClearBackbuffer();
+            Draw_CopyBackBuffer();
+            if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
+            mp_isSyncing = false;
+            mSaveContextInit = true;
+            break;
+        }
 
-        u8 offsetY = 1;
-        const char* titleString = mp_foundSyncer ? "Syncing..." : "Looking for syncer...";
-        Draw_DrawString(SCREEN_BOT_WIDTH / 2 - (strlen(titleString) / 2) * SPACING_X, 16 + SPACING_Y * offsetY++, COLOR_WHITE, titleString);
-
-        if (mp_foundSyncer) {
-            offsetY++;
-            static const char* syncPacketNames[] = { "Base Sync", "Save Scene Flags 1", "Save Scene Flags 2", "Save Scene Flags 3", "Save Scene Flags 4", "Entrance Data" };
-            static const u8 squareSize = 9;
-            for (size_t i = 0; i < ARRAY_SIZE(mp_completeSyncs); i++) {
-                Draw_DrawRect(10, 16 + SPACING_Y * offsetY, squareSize, squareSize, COLOR_WHITE);
-                Draw_DrawRect(11, 17 + SPACING_Y * offsetY, squareSize - 2, squareSize - 2, mp_completeSyncs[i] ? COLOR_GREEN : COLOR_BLACK);
-                Draw_DrawString(10 + SPACING_X * 2, 16 + SPACING_Y * offsetY++, COLOR_WHITE, syncPacketNames[i]);
-            }
-            if (Multiplayer_GetNeededPacketsMask() != 0) {
-                Multiplayer_Send_FullSyncRequest(Multiplayer_GetNeededPacketsMask());
-            } else {
-                // Syncing is done!
-                offsetY++;
-                const char* msgString = "Done!";
-                Draw_DrawString(SCREEN_BOT_WIDTH / 2 - (strlen(msgString) / 2) * SPACING_X, 16 + SPACING_Y * offsetY, COLOR_WHITE, msgString);
-                Draw_CopyBackBuffer();
-                svcSleepThread(1000 * 1000 * 1000LL);
+        // Look for a syncer for 5 seconds
+        if (!mp_foundSyncer && ticks - startTicks >= 5 * TICKS_PER_SEC) {
+            Draw_ClearBackbuffer();
+            const char* msgString = "No syncer found.";
+            Draw_DrawString(SCREEN_BOT_WIDTH / 2 - (strlen(msgString) / 2) * SPACING_X, 10 + SPACING_Y * 2, COLOR_WHITE, msgString);
+            Draw_CopyBackBuffer();
+            svcSleepThread(1000 * 1000 * 1000LL);
+
+            Draw_ClearBackbuffer();
+            Draw_CopyBackBuffer();
+            if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
+            mp_isSyncing = false;
+            break;
+        }
 
-                Draw_ClearBackbuffer();
-                Draw_CopyBackBuffer();
-                if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
-                mp_isSyncing = false;
-                mSaveContextInit = true;
-                break;
-            }
-        } else {
-            Multiplayer_Send_FullSyncRequest(0); // Send 0 to only ask for ping, to reduce chance of packet loss
-            static u8 syncerSearchTimer = 0;
-            // Look for a syncer for 5 seconds
-            if (syncerSearchTimer >= 5) {
-                Draw_ClearBackbuffer();
-                const char* msgString = "No syncer found.";
-                Draw_DrawString(SCREEN_BOT_WIDTH / 2 - (strlen(msgString) / 2) * SPACING_X, 10 + SPACING_Y * offsetY, COLOR_WHITE, msgString);
-                Draw_CopyBackBuffer();
-                svcSleepThread(1000 * 1000 * 1000LL);
+        // Ask again right away when something arrived, only resend the same request in case it got lost.
+        // Before a syncer is found, 0 only asks for a ping, to reduce chance of packet loss
+        if (neededMask != lastRequestMask || ticks - lastRequestTicks >= SYNC_REQUEST_RESEND_TICKS) {
+            Multiplayer_Send_FullSyncRequest(neededMask);
+            lastRequestMask = neededMask;
+            lastRequestTicks = ticks;
+        }
 
-                Draw_ClearBackbuffer();
-                Draw_CopyBackBuffer();
-                if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
-                mp_isSyncing = false;
-                break;
-            }
-            syncerSearchTimer++;
+        if (neededMask != drawnMask || mp_foundSyncer != drawnFoundSyncer) {
+            Gfx_DrawSyncProgress(neededMask);
+            Draw_CopyBackBuffer();
+            if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
+            drawnMask = neededMask;
+            drawnFoundSyncer = mp_foundSyncer;
         }
 
+        svcSleepThread(SYNC_MENU_POLL_NS);
+
+    } while (true);
+}
+
+// The group of the first check in the scene, to show roughly where a player is
+static const char* Gfx_GetSceneGroupName(s16 sceneNum) {
+    if (sceneNum < 0 || sceneNum >= SPOILER_SCENES_MAX || gSpoilerData.SceneItemCounts[sceneNum] == 0) {
+        return "Elsewhere";
+    }
+    u16 itemIndex = gSpoilerData.SceneItemLocations[gSpoilerData.SceneOffsets[sceneNum]];
+    SpoilerCollectionCheckGroup group = gSpoilerData.ItemLocations[itemIndex].Group;
+    return group == GROUP_NO_GROUP ? "Grottos" : spoilerCollectionGroupNames[group];
+}
+
+static void Gfx_CountSpectatedItems(const PlayerSummary* summary, u16 startIndex, u16 itemCount, u16* collected, u16* collectable) {
+    *collected = 0;
+    *collectable = 0;
+    for (u16 i = startIndex; i < startIndex + itemCount; i++) {
+        if (Multiplayer_Spectator_IsCollected(summary, i)) {
+            (*collected)++;
+            (*collectable)++;
+        } else if (gSpoilerData.ItemLocations[i].CollectType != COLLECTTYPE_NEVER) {
+            (*collectable)++;
+        }
+    }
+}
+
+static void Gfx_DrawSpectatorPlayers(u8 selectedPlayer, u8 playerScroll) {
+    u8 playerCount = Multiplayer_Spectator_PlayerCount();
+    Draw_DrawFormattedString(10, 16, COLOR_TITLE, "Spectating - %d player%s", playerCount, playerCount == 1 ? "" : "s");
+    if (playerCount == 0) {
+        Draw_DrawString(10, 46, COLOR_WHITE, "Waiting for players...");
+        return;
+    }
+
+    u16 listTopY = 32;
+    for (u8 line = 0; line < SPECTATOR_PLAYER_LINES && playerScroll + line < playerCount; line++) {
+        u16 networkID;
+        const PlayerSummary* summary = Multiplayer_Spectator_GetPlayer(playerScroll + line, &networkID);
+        u16 collected, collectable;
+        Gfx_CountSpectatedItems(summary, 0, gSpoilerData.ItemLocationsCount, &collected, &collectable);
+
+        u32 posY = listTopY + (SPACING_Y + SPACING_SMALL_Y + 2) * line;
+        u32 color = playerScroll + line == selectedPlayer ? COLOR_GREEN : COLOR_WHITE;
+        Draw_DrawFormattedString(10, posY, color, "Team %d  Player %d", summary->syncId, networkID);
+        Draw_DrawFormattedString(SCREEN_BOT_WIDTH - 10 - SPACING_X * 9, posY, color, "%4d/%-4d", collected, collectable);
+
+        u8 medallions = __builtin_popcount(summary->questItems & 0x3F);
+        u8 stones = __builtin_popcount((summary->questItems >> 18) & 0x7);
+        Draw_DrawFormattedString_Small(10 + SPACING_SMALL_X * 2, posY + SPACING_Y, COLOR_WHITE, "%s, %s, %d/%d hearts, %dM %dS %d skulls",
+            Gfx_GetSceneGroupName(summary->currentScene), summary->age == 0 ? "Adult" : "Child",
+            summary->health / 16, summary->healthCapacity / 16, medallions, stones, summary->gsTokens);
+    }
+
+    Gfx_DrawScrollBar(SCREEN_BOT_WIDTH - 3, listTopY, SCREEN_BOT_HEIGHT - 40 - listTopY, playerScroll, playerCount, SPECTATOR_PLAYER_LINES);
+}
+
+static void Gfx_DrawSpectatorGroups(u8 selectedPlayer, s16 groupScroll) {
+    u16 networkID;
+    const PlayerSummary* summary = Multiplayer_Spectator_GetPlayer(selectedPlayer, &networkID);
+    if (summary == NULL) {
+        return;
+    }
+    u16 collected, collectable;
+    Gfx_CountSpectatedItems(summary, 0, gSpoilerData.ItemLocationsCount, &collected, &collectable);
+    Draw_DrawFormattedString(10, 16, COLOR_TITLE, "Team %d Player %d - %d / %d", summary->syncId, networkID, collected, collectable);
+
+    u16 listTopY = 32;
+    u16 groupCount = SPOILER_COLLECTION_GROUP_COUNT - 1;
+    for (u32 line = 0; line < MAX_ENTRY_LINES * 2 && groupScroll + line < groupCount; line++) {
+        SpoilerCollectionCheckGroup group = groupScroll + line + 1;
+        Gfx_CountSpectatedItems(summary, gSpoilerData.GroupOffsets[group], gSpoilerData.GroupItemCounts[group], &collected, &collectable);
+
+        u32 posY = listTopY + (SPACING_SMALL_Y + 1) * line;
+        u32 color = collected == collectable ? COLOR_GREEN : COLOR_WHITE;
+        Draw_DrawString_Small(10, posY, color, spoilerCollectionGroupNames[group]);
+        Draw_DrawFormattedString_Small(SCREEN_BOT_WIDTH - 10 - SPACING_SMALL_X * 7, posY, color, "%3d/%-3d", collected, collectable);
+    }
+
+    Gfx_DrawScrollBar(SCREEN_BOT_WIDTH - 3, listTopY, SCREEN_BOT_HEIGHT - 40 - listTopY, groupScroll, groupCount, MAX_ENTRY_LINES * 2);
+}
+
+// Spectators never load a save, so once they're connected the bottom screen stays on the tracker.
+// The loop is left when the connection drops, so the multiplayer code can reconnect.
+static void Gfx_ShowSpectatorMenu(void) {
+    Draw_ClearFramebuffer();
+    if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
+
+    static u8 selectedPlayer = 0;
+    static u8 playerScroll = 0;
+    static s16 groupScroll = 0;
+    static bool showingGroups = false;
+    u64 lastUpdateTicks = 0;
+    pressed = 0;
+    Input_Reset();
+
+    do {
+        if (Clock_IsAsleep() || Multiplayer_GetStatus() != MP_STATUS_CONNECTED) {
+            break;
+        }
+
+        Clock_Update();
+        if (Clock_GetTicks() - lastUpdateTicks >= TICKS_PER_SEC) {
+            Multiplayer_Update(0);
+            lastUpdateTicks = Clock_GetTicks();
+        }
+
+        u8 playerCount = Multiplayer_Spectator_PlayerCount();
+        if (pressed & BUTTON_A && playerCount > 0) {
+            showingGroups = true;
+            groupScroll = 0;
+        } else if (pressed & BUTTON_B) {
+            showingGroups = false;
+        } else if (showingGroups && pressed & (BUTTON_UP | BUTTON_DOWN)) {
+            s16 maxScroll = SPOILER_COLLECTION_GROUP_COUNT - 1 - MAX_ENTRY_LINES * 2;
+            groupScroll += pressed & BUTTON_UP ? -1 : 1;
+            if (groupScroll > maxScroll) { groupScroll = maxScroll; }
+            if (groupScroll < 0) { groupScroll = 0; }
+        } else if (!showingGroups && pressed & BUTTON_UP && selectedPlayer > 0) {
+            selectedPlayer--;
+        } else if (!showingGroups && pressed & BUTTON_DOWN) {
+            selectedPlayer++;
+        }
+        // Players can leave at any time
+        if (selectedPlayer >= playerCount) {
+            selectedPlayer = playerCount > 0 ? playerCount - 1 : 0;
+            showingGroups &= playerCount > 0;
+        }
+        if (selectedPlayer < playerScroll) {
+            playerScroll = selectedPlayer;
+        } else if (selectedPlayer >= playerScroll + SPECTATOR_PLAYER_LINES) {
+            playerScroll = selectedPlayer - SPECTATOR_PLAYER_LINES + 1;
+        }
+
+        Draw_ClearBackbuffer();
+        if (showingGroups) {
+            Gfx_DrawSpectatorGroups(selectedPlayer, groupScroll);
+        } else {
+            Gfx_DrawSpectatorPlayers(selectedPlayer, playerScroll);
+        }
+        Draw_DrawString(10, SCREEN_BOT_HEIGHT - 20, COLOR_TITLE, showingGroups ? "B: Back  Up/Down: Scroll" : "A: Show areas  Up/Down: Select");
         Draw_CopyBackBuffer();
         if (gSettingsContext.playOption == PLAY_ON_CONSOLE) { Draw_FlushFramebuffer(); }
 
-        svcSleepThread(1000 * 1000 * 1000LL);
+        pressed = Input_WaitWithTimeout(MENU_NETWORK_INTERVAL_MS);
+        Multiplayer_ReceivePackets();
 
     } while (true);
 }
@@ -1014,11 +1716,17 @@ void Gfx_Init(void) {
         menu_draw_funcs[PAGE_ITEMTRACKER_ALL] = NULL;
         menu_draw_funcs[PAGE_ITEMTRACKER_GROUPS] = NULL;
     }
+    if (gSpoilerData.HintCount == 0) {
+        menu_draw_funcs[PAGE_HINTLOG] = NULL;
+    }
     InitEntranceTrackingData();
     if (gEntranceTrackingData.EntranceCount == 0) {
         menu_draw_funcs[PAGE_ENTRANCETRACKER_ALL] = NULL;
         menu_draw_funcs[PAGE_ENTRANCETRACKER_GROUPS] = NULL;
     }
+    if (gEntranceTrackingData.EntranceCount == 0 || gSpoilerData.RouteNodeCount == 0) {
+        menu_draw_funcs[PAGE_ENTRANCEROUTE] = NULL;
+    }
 
     // Call these to go to the first non-empty group page
     if (gSpoilerData.ItemLocationsCount > 0 && gSpoilerData.GroupItemCounts[currentItemGroup] == 0) {
@@ -1045,34 +1753,46 @@ static u8 openingButton(void){
 void Gfx_Update(void) {
     if (!GfxInit) {
         Gfx_Init();
-        lastTick = svcGetSystemTick();
     }
 
     if (mp_isSyncing) {
         Gfx_ShowMultiplayerSyncMenu();
     }
 
-    // The update is called here so it works while in different game modes (title screen, file select, boss challenge, credits, MQ unlock)
-    static u64 lastTickM = 0;
-    static u64 elapsedTicksM = 0;
-    elapsedTicksM += svcGetSystemTick() - lastTickM;
-    if (elapsedTicksM >= TICKS_PER_SEC) {
+    if (gSettingsContext.mp_Spectator && Multiplayer_GetStatus() == MP_STATUS_CONNECTED) {
+        Gfx_ShowSpectatorMenu();
+    }
+
+    PROFILER_START(PROFILER_GFX);
+    Clock_Update();
+
+    // The update is called here so it works while in different game modes (title screen, file select, boss challenge, credits, MQ unlock).
+    // Packets are still pulled every frame, so requests from players joining or reconnecting are answered right away
+    static u64 lastNetworkUpdateTicks = 0;
+    if (Clock_GetTicks() - lastNetworkUpdateTicks >= TICKS_PER_SEC) {
         if (!IsInGame()) {
             Multiplayer_Update(0);
         }
-        elapsedTicksM = 0;
+        lastNetworkUpdateTicks = Clock_GetTicks();
+    } else if (!IsInGame()) {
+        Multiplayer_ReceivePackets();
     }
-    lastTickM = svcGetSystemTick();
 
-    Gfx_UpdatePlayTime();
+    SplitTimer_Update();
+    PROFILER_STOP(PROFILER_GFX);
 
-    if(!isAsleep && openingButton() && IsInGame()){
+    if(!Clock_IsAsleep() && openingButton() && IsInGame()){
+        Clock_OnMenuOpen();
+        Multiplayer_OnMenuOpen();
         Gfx_ShowMenu();
+        Multiplayer_OnMenuClose();
         // Check again as it's possible the system was put to sleep while the menu was open
-        if (!isAsleep) {
-            svcSleepThread(1000 * 1000 * 300LL);
-            // Update lastTick one more time so we don't count the added 0.3s sleep
-            lastTick = svcGetSystemTick();
+        if (!Clock_IsAsleep()) {
+            // Keep the game paused until the closing button is let go, so the game doesn't act on it
+            // and the menu doesn't open again right away
+            Input_WaitForRelease(pressed & closingButton, 1000);
+            Input_Reset();
         }
+        Clock_OnMenuClose();
     }
 }
@@ -1,5 +1,7 @@
 #include "z3D/z3D.h"
 #include "settings.h"
+#include "savefile.h"
+#include "hints.h"
 
 #define MASK_OF_TRUTH_ID 8
 #define MAX_SARIAS_SONG_HINTS 64
@@ -47,6 +49,14 @@ void Hints_AddSariasSongHint(u16 textId) {
     }
 }
 
+// The stones read are kept in the save for Saria's Song, so the hint log uses the same flags
+u8 Hints_GetIsHintRead(u16 textId) {
+    u8 textIdSceneOffset = (textId & 0xF0) >> 4;
+    u8 textIdLookupBit = textId & 0xF;
+
+    return (gSaveContext.sceneFlags[SCENE_YDAN_BOSS + textIdSceneOffset].unk & (1 << textIdLookupBit)) != 0;
+}
+
 void Hints_LoadSariasSongHints(void) {
     for (u8 i = 0; i < 0x40; i++) {
         u8 textIdSceneOffset = (i & 0xF0) >> 4;
@@ -0,0 +1,8 @@
+#ifndef _HINTS_H_
+#define _HINTS_H_
+
+#include "z3D/z3D.h"
+
+u8 Hints_GetIsHintRead(u16 textId);
+
+#endif //_HINTS_H_
@@ -4,6 +4,7 @@
 #include "settings.h"
 #include "common.h"
 #include "input.h"
+#include "item_override.h"
 
 #define TimerFrameCounter *(s16*)0x539D8A // Used to decrease the timer every 30 frames
 #define ControlStick_X *(float*)0x5655C0
@@ -13,7 +14,8 @@ static u8 pendingFreezes = 0;
 static u8 cooldown = 0;
 static u8 modifyScale = 0;
 
-static u32 source[16];
+#define ICETRAP_PENDING_MAX 16
+static u32 source[ICETRAP_PENDING_MAX];
 
 s8 IceTrap_ActiveCurse = -1;
 static s16 previousTimer1Value = 0;
@@ -66,12 +68,29 @@ void IceTrap_InitTypes(void) {
     }
 }
 
+// The generator gives every trap its own seed, so a trap has the same effect on every console.
+// Traps without one (vanilla trap chests, seeds from older versions) hash the fallback instead.
+u32 IceTrap_GetSeed(u32 key, u32 fallback) {
+    if (key != 0) {
+        ItemOverride override = ItemOverride_LookupByKey((ItemOverride_Key){ .all = key });
+        if (override.value.trapSeed != 0) {
+            return override.value.trapSeed;
+        }
+    }
+    return Hash(fallback);
+}
+
 u32 IceTrap_IsPending(void) {
     return pendingFreezes > 0;
 }
 
-void IceTrap_Push(u32 key) {
+// Returns 0 if there are already too many traps waiting to go off
+u8 IceTrap_Push(u32 key) {
+    if (pendingFreezes >= ICETRAP_PENDING_MAX) {
+        return 0;
+    }
     source[pendingFreezes++] = key;
+    return 1;
 }
 
 void LinkDamageNoKnockback(void) {
@@ -92,7 +111,7 @@ void IceTrap_Give(void) {
 
     if (cooldown == 0 && pendingFreezes &&
         ExtendedObject_IsLoaded(&gGlobalContext->objectCtx, ExtendedObject_GetIndex(&gGlobalContext->objectCtx, 0x3))) {
-        u32 pRandInt = dizzyCurseSeed = Hash(source[0]);
+        u32 pRandInt = dizzyCurseSeed = IceTrap_GetSeed(source[0], source[0]);
 
         u8 trapType = ICETRAP_VANILLA; // Default to ice trap
         if (gSettingsContext.randomTrapDmg != RANDOMTRAPS_OFF) {
@@ -100,7 +119,7 @@ void IceTrap_Give(void) {
         }
 
         pendingFreezes--;
-        for (int i = 0; i < 15; i++) {
+        for (int i = 0; i < ICETRAP_PENDING_MAX - 1; i++) {
             source[i] = source[i + 1];
         }
 
@@ -125,7 +144,7 @@ void IceTrap_Give(void) {
         }
 
         if (trapType == ICETRAP_FIRE) {
-            FireDamage(&(PLAYER->actor), gGlobalContext, gRandInt % 2);
+            FireDamage(&(PLAYER->actor), gGlobalContext, (pRandInt >> 8) % 2);
         }
         if (trapType == ICETRAP_SCALE) {
             LinkDamageNoKnockback();
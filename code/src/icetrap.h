@@ -8,7 +8,8 @@ extern u32 possibleChestTraps[20];
 extern u32 possibleChestTrapsAmount;
 extern u32 dizzyCurseSeed;
 
-void IceTrap_Push(u32 key);
+u8   IceTrap_Push(u32 key);
+u32  IceTrap_GetSeed(u32 key, u32 fallback);
 void IceTrap_Give(void);
 u32  IceTrap_IsPending(void);
 void IceTrap_Update(void);
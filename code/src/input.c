@@ -4,82 +4,137 @@
 #include "hid.h"
 #include "3ds/svc.h"
 #include "utils.h"
+#include "common.h"
 
-u32 GetCurrentPadState(void) {
-    u32 hid_shared_mem = *(u32*)(0x005AEC5C);
-    return *(volatile u32*)(hid_shared_mem + 0x1C);
-}
-#define HID_PAD (GetCurrentPadState())
+// Directions repeat while held, so lists can be scrolled without pressing the button again each time
+#define REPEAT_BUTTONS (BUTTON_UP | BUTTON_DOWN | BUTTON_LEFT | BUTTON_RIGHT)
+#define REPEAT_DELAY (TICKS_PER_SEC / 1000 * 400)
+#define REPEAT_INTERVAL (TICKS_PER_SEC / 1000 * 100)
+#define TICKS_PER_MSEC (TICKS_PER_SEC / 1000)
 
 InputContext rInputCtx;
 
+// Index and timestamp of the last pad sample in the HID shared memory that was read
+static u32 lastSampleIndex = 0;
+static u64 lastSampleTimestamp = 0;
+static u64 nextRepeatTick = 0;
+
+static void Input_UpdateRepeat(void) {
+    u64 currentTick = svcGetSystemTick();
+    rInputCtx.repeat.val = 0;
+    if (rInputCtx.pressed.val & REPEAT_BUTTONS) {
+        nextRepeatTick = currentTick + REPEAT_DELAY;
+    } else if ((rInputCtx.cur.val & REPEAT_BUTTONS) && currentTick >= nextRepeatTick) {
+        rInputCtx.repeat.val = rInputCtx.cur.val & REPEAT_BUTTONS;
+        nextRepeatTick = currentTick + REPEAT_INTERVAL;
+    }
+}
+
 void Input_Update(void) {
-    rInputCtx.cur.val = real_hid.pad.pads[real_hid.pad.index].curr.val;
+    lastSampleIndex = real_hid.pad.index;
+    lastSampleTimestamp = real_hid.pad.timestamp;
+    rInputCtx.cur.val = real_hid.pad.pads[lastSampleIndex].curr.val;
     rInputCtx.pressed.val = (rInputCtx.cur.val) & (~rInputCtx.old.val);
     rInputCtx.up.val = (~rInputCtx.cur.val) & (rInputCtx.old.val);
     rInputCtx.old.val = rInputCtx.cur.val;
+    Input_UpdateRepeat();
     rInputCtx.touchX = real_hid.touch.touches[real_hid.touch.index].touch.x;
     rInputCtx.touchY = real_hid.touch.touches[real_hid.touch.index].touch.y;
     rInputCtx.touchPressed = real_hid.touch.touches[real_hid.touch.index].updated && !rInputCtx.touchHeld;
     rInputCtx.touchHeld = real_hid.touch.touches[real_hid.touch.index].updated;
 }
 
-u32 buttonCheck(u32 key) {
-    for (u32 i = 0x26000; i > 0; i--) {
-        if (key != real_hid.pad.pads[real_hid.pad.index].curr.val)
-            return 0;
-    }
-    return 1;
+void Input_Reset(void) {
+    lastSampleIndex = real_hid.pad.index;
+    lastSampleTimestamp = real_hid.pad.timestamp;
+    rInputCtx.cur.val = real_hid.pad.pads[lastSampleIndex].curr.val;
+    rInputCtx.old.val = rInputCtx.cur.val;
+    rInputCtx.pressed.val = 0;
+    rInputCtx.up.val = 0;
+    rInputCtx.repeat.val = 0;
 }
 
-u32 Input_WaitWithTimeout(u32 msec, u32 closingButton) {
-    u32 pressedKey = 0;
-    u32 key = 0;
-    u32 n = 0;
-    u32 startingButtonState = HID_PAD;
-
-    // Wait for no keys to be pressed
-    while (HID_PAD && (msec == 0 || n <= msec)) {
-        svcSleepThread(1 * 1000 * 1000LL);
-        n++;
-
-        // If the player presses the closing button while still holding other buttons, the menu closes (useful for
-        // buffering);
-        u32 tempButtons = HID_PAD;
-        if (tempButtons != startingButtonState && buttonCheck(tempButtons)) {
+// Reads every pad sample the HID module wrote since the last one that was read, using the pressed and released
+// edges it already computed, so short taps aren't missed. Returns false if there were no new samples.
+static bool Input_ReadSamples(void) {
+    u32 index = real_hid.pad.index;
+    u64 timestamp = real_hid.pad.timestamp;
+    // The index alone can't tell whether the ring went all the way around, so the timestamp says if there's anything new
+    if (timestamp == lastSampleTimestamp) {
+        return false;
+    }
 
-            if (tempButtons & closingButton) {
-                break;
-            } else {
-                startingButtonState = tempButtons;
-            }
+    u32 pressed = 0;
+    u32 released = 0;
+    u32 current = real_hid.pad.pads[index].curr.val;
+    u64 interval = timestamp - real_hid.pad.timestamp_last;
+    if (interval == 0 || timestamp - lastSampleTimestamp >= interval * ARRAY_SIZE(real_hid.pad.pads)) {
+        // The ring was overwritten since the last read, so take every sample still in it and compare the
+        // latest state with the last one read to catch what changed in the samples that were lost
+        for (u32 i = 0; i < ARRAY_SIZE(real_hid.pad.pads); i++) {
+            pressed |= real_hid.pad.pads[i].pressed.val;
+            released |= real_hid.pad.pads[i].released.val;
         }
+        pressed |= current & ~rInputCtx.old.val;
+        released |= rInputCtx.old.val & ~current;
+        lastSampleIndex = index;
+    }
+    while (lastSampleIndex != index) {
+        lastSampleIndex = (lastSampleIndex + 1) % ARRAY_SIZE(real_hid.pad.pads);
+        pressed |= real_hid.pad.pads[lastSampleIndex].pressed.val;
+        released |= real_hid.pad.pads[lastSampleIndex].released.val;
     }
+    lastSampleTimestamp = timestamp;
+    rInputCtx.cur.val = current;
+    rInputCtx.pressed.val = pressed;
+    rInputCtx.up.val = released;
+    rInputCtx.old.val = rInputCtx.cur.val;
+    Input_UpdateRepeat();
+    return true;
+}
 
-    if (msec != 0 && n >= msec) {
-        return 0;
+// Sleeps until the HID module should have written the next pad sample
+static void Input_WaitForSample(void) {
+    u64 interval = real_hid.pad.timestamp - real_hid.pad.timestamp_last;
+    u64 nextSampleTick = real_hid.pad.timestamp + interval;
+    u64 currentTick = svcGetSystemTick();
+    u64 ticks = nextSampleTick > currentTick ? nextSampleTick - currentTick : 0;
+    // Keep the wait sane in case the timestamps haven't been written yet
+    if (ticks < TICKS_PER_MSEC) {
+        ticks = TICKS_PER_MSEC;
+    } else if (ticks > TICKS_PER_MSEC * 16) {
+        ticks = TICKS_PER_MSEC * 16;
     }
+    svcSleepThread(ticks * 1000 * 1000 / TICKS_PER_MSEC);
+}
 
+// Returns every button held when a new one is pressed, like it always has, or the directions repeating while held
+u32 Input_WaitWithTimeout(u32 msec) {
+    u64 startTick = svcGetSystemTick();
     do {
-        // Wait for a key to be pressed
-        while (!HID_PAD && (msec == 0 || n < msec)) {
-            svcSleepThread(1 * 1000 * 1000LL);
-            n++;
-        }
-
-        if (msec != 0 && n >= msec) {
-            return 0;
+        if (Input_ReadSamples()) {
+            // A short tap can already be let go by the latest sample, so the pressed buttons are added in
+            if (rInputCtx.pressed.val) {
+                return rInputCtx.cur.val | rInputCtx.pressed.val;
+            }
+            if (rInputCtx.repeat.val) {
+                return rInputCtx.repeat.val;
+            }
         }
+        Input_WaitForSample();
+    } while (msec == 0 || svcGetSystemTick() - startTick < (u64)msec * TICKS_PER_MSEC);
 
-        key = HID_PAD;
-
-        // Make sure it's pressed
-        pressedKey = buttonCheck(key);
-    } while (!pressedKey);
+    return 0;
+}
 
-    return key;
+void Input_WaitForRelease(u32 buttons, u32 msec) {
+    u64 startTick = svcGetSystemTick();
+    while ((real_hid.pad.pads[real_hid.pad.index].curr.val & buttons) &&
+           (msec == 0 || svcGetSystemTick() - startTick < (u64)msec * TICKS_PER_MSEC)) {
+        Input_WaitForSample();
+    }
 }
 
 u32 Input_Wait(void) {
-    return Input_WaitWithTimeout(0, 0);
+    return Input_WaitWithTimeout(0);
 }
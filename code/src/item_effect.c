@@ -3,6 +3,7 @@
 #include "z3D/z3D.h"
 #include "savefile.h"
 #include "multiplayer.h"
+#include "split_timer.h"
 
 void ItemEffect_None(SaveContext* saveCtx, s16 arg1, s16 arg2) {
 }
@@ -65,6 +66,9 @@ void ItemEffect_GiveBottle(SaveContext* saveCtx, s16 bottleItemId, s16 arg2) {
 
 void ItemEffect_GiveDungeonItem(SaveContext* saveCtx, s16 mask, s16 dungeonId) {
     saveCtx->dungeonItems[dungeonId] |= mask;
+    if ((mask & 0x1) && dungeonId < SPLIT_DUNGEON_COUNT) {
+        SplitTimer_Record(SPLIT_BOSS_KEY + dungeonId);
+    }
 }
 
 void ItemEffect_GiveSmallKey(SaveContext* saveCtx, s16 dungeonId, s16 arg2) {
@@ -393,10 +397,21 @@ void ItemEffect_GiveChildKokiriSword(SaveContext* saveCtx, s16 arg1, s16 arg2) {
 void ItemEffect_GiveStone(SaveContext* saveCtx, s16 mask, s16 arg2) {
     s32 trueMask = mask << 16;
     saveCtx->questItems |= trueMask;
+    // Stone masks are 0x4, 0x8 and 0x10 before the shift
+    for (u8 i = 0; i < 3; i++) {
+        if (mask & (0x4 << i)) {
+            SplitTimer_Record(SPLIT_REWARD + KOKIRI_EMERALD + i);
+        }
+    }
 }
 
 void ItemEffect_GiveMedallion(SaveContext* saveCtx, s16 mask, s16 arg2) {
     saveCtx->questItems |= mask;
+    for (u8 i = 0; i < 6; i++) {
+        if (mask & (1 << i)) {
+            SplitTimer_Record(SPLIT_REWARD + FOREST_MEDALLION + i);
+        }
+    }
 }
 
 void ItemEffect_MoveNabooru(SaveContext* saveCtx, s16 arg1, s16 arg2) {
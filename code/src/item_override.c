@@ -8,6 +8,9 @@
 #include "entrance.h"
 #include "savefile.h"
 #include "common.h"
+#include "profiler.h"
+#include "multiplayer.h"
+#include "spoiler_data.h"
 #include <stddef.h>
 
 #include "z3D/z3D.h"
@@ -17,10 +20,14 @@
 #define READY_ON_LAND 1
 #define READY_IN_WATER 2
 
-static ItemOverride rItemOverrides[640] = { 0 };
+static ItemOverride rItemOverrides[ITEM_OVERRIDES_MAX] = { 0 };
 static s32 rItemOverrides_Count = 0;
 
-static ItemOverride rPendingOverrideQueue[3] = { 0 };
+// Every local source of pending items has its own key, and there are fewer of them than this, so they always
+// fit in the queue. Multiworld items only get the rest, their senders keep sending them until they're given.
+#define PENDING_LOCAL_RESERVE 40
+#define rPendingItems gExtSaveData.pendingItems
+
 static Actor* rDummyActor = NULL;
 
 static ItemOverride rActiveItemOverride = { 0 };
@@ -158,21 +165,40 @@ static ItemOverride_Key ItemOverride_GetSearchKey(Actor* actor, u8 scene, u8 ite
     }
 }
 
-ItemOverride ItemOverride_LookupByKey(ItemOverride_Key key) {
+// Returns the index of the override in the table, or -1 if there isn't one for this key
+s32 ItemOverride_GetIndex(ItemOverride_Key key) {
     s32 start = 0;
     s32 end = rItemOverrides_Count - 1;
     while (start <= end) {
         s32 midIdx = (start + end) / 2;
-        ItemOverride midOvr = rItemOverrides[midIdx];
-        if (key.all < midOvr.key.all) {
+        ItemOverride_Key midKey = rItemOverrides[midIdx].key;
+        if (key.all < midKey.all) {
             end = midIdx - 1;
-        } else if (key.all > midOvr.key.all) {
+        } else if (key.all > midKey.all) {
             start = midIdx + 1;
         } else {
-            return midOvr;
+            return midIdx;
         }
     }
-    return (ItemOverride){ 0 };
+    return -1;
+}
+
+ItemOverride ItemOverride_GetByIndex(s32 index) {
+    if (index < 0 || index >= rItemOverrides_Count) {
+        return (ItemOverride){ 0 };
+    }
+    return rItemOverrides[index];
+}
+
+ItemOverride ItemOverride_LookupByKey(ItemOverride_Key key) {
+    return ItemOverride_GetByIndex(ItemOverride_GetIndex(key));
+}
+
+// Items received from other multiworld players keep the sender in the key's padding byte, so they never match
+// a key of our own table.
+static u8 ItemOverride_IsForAnotherPlayer(ItemOverride override) {
+    return gSettingsContext.mw_Players > 1 && override.key.pad_ == 0 && override.value.player != 0 &&
+           override.value.player != 0xFF && override.value.player != gSettingsContext.mw_PlayerId;
 }
 
 ItemOverride ItemOverride_Lookup(Actor* actor, u8 scene, u8 itemId) {
@@ -184,14 +210,27 @@ ItemOverride ItemOverride_Lookup(Actor* actor, u8 scene, u8 itemId) {
     return ItemOverride_LookupByKey(key);
 }
 
+// Items for another multiworld player show their own model, with a message saying who they're for
+static ItemRow* ItemOverride_GetMultiworldRow(ItemOverride override, u16* looksLikeItemId) {
+    ItemRow* itemRow = ItemTable_GetItemRow(GI_EXT_MULTIWORLD_ITEM);
+    itemRow->textId = 0x930A + override.value.player - 1;
+    if (*looksLikeItemId == 0) {
+        *looksLikeItemId = ItemTable_ResolveUpgrades(override.value.itemId);
+    }
+    return itemRow;
+}
+
 static void ItemOverride_Activate(ItemOverride override) {
     u16 resolvedItemId = ItemTable_ResolveUpgrades(override.value.itemId);
     ItemRow* itemRow = ItemTable_GetItemRow(resolvedItemId);
-    u8 looksLikeItemId = override.value.looksLikeItemId;
+    u16 looksLikeItemId = override.value.looksLikeItemId;
 
     if (override.value.itemId == 0x7C) { // Ice trap
         looksLikeItemId = 0;
     }
+    if (ItemOverride_IsForAnotherPlayer(override)) {
+        itemRow = ItemOverride_GetMultiworldRow(override, &looksLikeItemId);
+    }
 
     rActiveItemOverride = override;
     rActiveItemRow = itemRow;
@@ -212,21 +251,46 @@ static void ItemOverride_Clear(void) {
     rActiveItemFastChest = 0;
 }
 
-static void ItemOverride_PushPendingOverride(ItemOverride override) {
-    for (u32 i = 0; i < ARR_SIZE(rPendingOverrideQueue); ++i) {
-        if (rPendingOverrideQueue[i].key.all == 0) {
-            rPendingOverrideQueue[i] = override;
-            break;
-        }
-        if (rPendingOverrideQueue[i].key.all == override.key.all) {
+static ItemOverride ItemOverride_PeekPendingOverride(void) {
+    if (rPendingItems.count == 0) {
+        return (ItemOverride){ 0 };
+    }
+    return rPendingItems.items[rPendingItems.head];
+}
+
+// Returns 0 if there's no room for the item
+static u8 ItemOverride_PushPendingOverride(ItemOverride override) {
+    if (override.key.all == 0) {
+        return 1;
+    }
+    for (u32 i = 0; i < rPendingItems.count; ++i) {
+        if (rPendingItems.items[(rPendingItems.head + i) % SAVEFILE_PENDING_ITEMS_MAX].key.all == override.key.all) {
             // Prevent duplicate entries
-            break;
+            return 1;
         }
     }
+    u32 limit = SAVEFILE_PENDING_ITEMS_MAX;
+    if (override.key.pad_ != 0) {
+        limit -= PENDING_LOCAL_RESERVE;
+    }
+    if (rPendingItems.count >= limit) {
+        return 0;
+    }
+    rPendingItems.items[(rPendingItems.head + rPendingItems.count) % SAVEFILE_PENDING_ITEMS_MAX] = override;
+    rPendingItems.count++;
+    return 1;
+}
+
+// Queues an item another multiworld player found for us. Returns 0 if there's no room, the sender keeps
+// sending it until it's been given anyway.
+u8 ItemOverride_PushMultiworldItem(u8 fromPlayer, ItemOverride_Key key, u16 itemId) {
+    key.pad_ = fromPlayer;
+    ItemOverride override = { .key = key, .value = { .itemId = itemId } };
+    return ItemOverride_PushPendingOverride(override);
 }
 
 s32 ItemOverride_IsAPendingOverride(void) {
-    return (rPendingOverrideQueue[0].key.all != 0);
+    return (rPendingItems.count != 0);
 }
 
 void ItemOverride_PushDelayedOverride(u8 flag) {
@@ -241,13 +305,26 @@ void ItemOverride_PushDelayedOverride(u8 flag) {
 }
 
 static void ItemOverride_PopPendingOverride(void) {
-    rPendingOverrideQueue[0] = rPendingOverrideQueue[1];
-    rPendingOverrideQueue[1] = rPendingOverrideQueue[2];
-    rPendingOverrideQueue[2].key.all = 0;
-    rPendingOverrideQueue[2].value.all = 0;
+    if (rPendingItems.count == 0) {
+        return;
+    }
+    rPendingItems.items[rPendingItems.head] = (ItemOverride){ 0 };
+    rPendingItems.head = (rPendingItems.head + 1) % SAVEFILE_PENDING_ITEMS_MAX;
+    rPendingItems.count--;
 }
 
 static void ItemOverride_AfterKeyReceived(ItemOverride_Key key) {
+    // Items from other multiworld players only need to be confirmed, their location is in another world
+    if (key.pad_ != 0) {
+        Multiplayer_Multiworld_OnItemReceived(key.pad_, key);
+        return;
+    }
+    SpoilerData_SetOverrideCollected(key);
+    ItemOverride override = ItemOverride_LookupByKey(key);
+    if (ItemOverride_IsForAnotherPlayer(override)) {
+        Multiplayer_Multiworld_SendItem(ItemOverride_GetIndex(key));
+    }
+
     ItemOverride_Key fireArrowKey = {
         .scene = 0x57, // Lake Hylia
         .type = OVR_BASE_ITEM,
@@ -278,10 +355,11 @@ static void ItemOverride_AfterKeyReceived(ItemOverride_Key key) {
 }
 
 static void ItemOverride_PopIceTrap(void) {
-    ItemOverride_Key key = rPendingOverrideQueue[0].key;
-    ItemOverride_Value value = rPendingOverrideQueue[0].value;
-    if (value.itemId == 0x7C) {
-        IceTrap_Push(key.all);
+    ItemOverride pending = ItemOverride_PeekPendingOverride();
+    ItemOverride_Key key = pending.key;
+    ItemOverride_Value value = pending.value;
+    // If too many traps are waiting already, this one stays queued until one of them goes off
+    if (value.itemId == 0x7C && IceTrap_Push(key.all)) {
         ItemOverride_PopPendingOverride();
         ItemOverride_AfterKeyReceived(key);
     }
@@ -324,7 +402,7 @@ static u32 ItemOverride_PlayerIsReadyInWater(void) {
         (PLAYER->stateFlags2 & 0x400) != 0 && // Player is underwater
         (PLAYER->stateFlags1 & 0x400) == 0 && // Player is not already receiving an item when surfacing
         gGlobalContext->sceneLoadFlag == 0 && // Another scene isn't about to be loaded
-        rPendingOverrideQueue[0].key.type == OVR_TEMPLE // Must be an item received for completing a dungeon
+        ItemOverride_PeekPendingOverride().key.type == OVR_TEMPLE // Must be an item received for completing a dungeon
         // && Multiworld is off
         // && (z64_event_state_1 & 0x20) == 0 //TODO
         // && (z64_game.camera_2 == 0) //TODO
@@ -351,7 +429,7 @@ static u32 ItemOverride_PlayerIsReady(void) {
 }
 
 static void ItemOverride_TryPendingItem(void) {
-    ItemOverride override = rPendingOverrideQueue[0];
+    ItemOverride override = ItemOverride_PeekPendingOverride();
 
     if (override.key.all == 0) {
         return;
@@ -370,7 +448,9 @@ static void ItemOverride_TryPendingItem(void) {
 void ItemOverride_Update(void) {
     ItemOverride_CheckStartingItem();
     ItemOverride_CheckZeldasLetter();
+    PROFILER_START(PROFILER_ICE_TRAP);
     IceTrap_Update();
+    PROFILER_STOP(PROFILER_ICE_TRAP);
     CustomModel_Update();
     u8 readyStatus = ItemOverride_PlayerIsReady();
     if (readyStatus) {
@@ -466,6 +546,14 @@ void ItemOverride_GetSkulltulaToken(Actor* tokenActor) {
         itemRow->effectArg1 = override.key.all >> 16;
         itemRow->effectArg2 = override.key.all & 0xFFFF;
     }
+    if (ItemOverride_IsForAnotherPlayer(override)) {
+        u16 looksLikeItemId = 0;
+        itemRow = ItemOverride_GetMultiworldRow(override, &looksLikeItemId);
+        resolvedItemId = GI_EXT_MULTIWORLD_ITEM;
+        ItemOverride_AfterKeyReceived(override.key);
+    } else if (override.key.all != 0) {
+        SpoilerData_SetOverrideCollected(override.key);
+    }
 
     ItemTable_CallEffect(itemRow);
 
@@ -2,6 +2,10 @@
 #define _ITEM_OVERRIDES_H_
 
 #include "../include/z3D/z3D.h"
+#include "extended_items.h"
+
+#define ITEM_OVERRIDES_MAX 640
+#define MULTIWORLD_MAX_PLAYERS 8
 
 extern u32 rActiveItemActionId;
 extern u32 rActiveItemFastChest;
@@ -29,13 +33,13 @@ typedef union ItemOverride_Key {
     };
 } ItemOverride_Key;
 
-typedef union ItemOverride_Value {
-    u32 all;
-    struct {
-        u16 itemId;
-        u8  player;
-        u8  looksLikeItemId;
-    };
+// Both item ids are 16 bits wide so they can refer to extended items
+typedef struct ItemOverride_Value {
+    u16 itemId;
+    u16 looksLikeItemId;
+    u8  player;
+    u8  pad_;
+    u16 trapSeed; // Picks an ice trap's effect, set by the generator so it's the same on every console
 } ItemOverride_Value;
 
 typedef struct ItemOverride {
@@ -44,6 +48,9 @@ typedef struct ItemOverride {
 } ItemOverride;
 
 ItemOverride ItemOverride_LookupByKey(ItemOverride_Key key);
+s32 ItemOverride_GetIndex(ItemOverride_Key key);
+ItemOverride ItemOverride_GetByIndex(s32 index);
+u8 ItemOverride_PushMultiworldItem(u8 fromPlayer, ItemOverride_Key key, u16 itemId);
 ItemOverride ItemOverride_Lookup(Actor* actor, u8 scene, u8 item_id);
 s32 ItemOverride_IsAPendingOverride(void);
 void ItemOverride_PushDelayedOverride(u8 flag);
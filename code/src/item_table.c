@@ -255,11 +255,26 @@ static ItemRow rItemTable[] = {
 
 };
 
+#define EXT_ITEM_ROW(itemId, ...) [(itemId) - EXTENDED_ITEM_ID_BASE] = ITEM_ROW(__VA_ARGS__)
+
+// Items that don't exist in the base game, see extended_items.h
+static ItemRow rExtendedItemTable[EXTENDED_ITEM_COUNT] = {
+    // Text ID and graphic are set when activated, from the owner and the item being sent
+    EXT_ITEM_ROW(GI_EXT_MULTIWORLD_ITEM, 0x53, 0, 0x41, 0x930A, 0x0000, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, ItemUpgrade_None, ItemEffect_None, -1, -1), // Multiworld item for another player
+};
+
 ItemRow* ItemTable_GetItemRow(u16 itemId) {
-    if (itemId >= ARR_SIZE(rItemTable)) {
+    ItemRow* itemRow;
+    if (IS_EXTENDED_ITEM_ID(itemId)) {
+        if (itemId >= GI_EXT_MAX) {
+            return NULL;
+        }
+        itemRow = &rExtendedItemTable[itemId - EXTENDED_ITEM_ID_BASE];
+    } else if (itemId < ARR_SIZE(rItemTable)) {
+        itemRow = &rItemTable[itemId];
+    } else {
         return NULL;
     }
-    ItemRow* itemRow = &rItemTable[itemId];
     if (itemRow->baseItemId == 0) {
         return NULL;
     }
@@ -2,6 +2,7 @@
 #define _ITEM_TABLE_H_
 
 #include "z3D/z3D.h"
+#include "extended_items.h"
 
 typedef u16 (*upgradeFunc)(SaveContext* saveCtx, u16 itemId);
 typedef void (*effectFunc)(SaveContext* saveCtx, s16 arg1, s16 arg2);
@@ -10,6 +10,8 @@
 #include "common.h"
 #include "savefile.h"
 #include "multiplayer.h"
+#include "profiler.h"
+#include "autotracker.h"
 
 #include "z3D/z3D.h"
 #include "3ds/extdata.h"
@@ -35,14 +37,28 @@ void before_GlobalContext_Update(GlobalContext* globalCtx) {
         set_GlobalContext(globalCtx);
         rRandomizerInit = 1;
     }
+#ifdef ENABLE_DEBUG
+    // Everything timed since the last time we got here belongs to the previous frame
+    Profiler_EndFrame();
+#endif
+    PROFILER_START(PROFILER_ITEM_OVERRIDE);
     ItemOverride_Update();
+    PROFILER_STOP(PROFILER_ITEM_OVERRIDE);
+    PROFILER_START(PROFILER_MODELS);
     Model_UpdateAll(globalCtx);
+    PROFILER_STOP(PROFILER_MODELS);
+    PROFILER_START(PROFILER_INPUT);
     Input_Update();
+    PROFILER_STOP(PROFILER_INPUT);
     SaveFile_EnforceHealthLimit();
 
     Settings_SkipSongReplays();
 
+    PROFILER_START(PROFILER_MULTIPLAYER);
     Multiplayer_Run();
+    PROFILER_STOP(PROFILER_MULTIPLAYER);
+
+    AutoTracker_Update();
 }
 
 void after_GlobalContext_Update() {
@@ -54,5 +70,7 @@ void after_GlobalContext_Update() {
         }
     }
 
+    PROFILER_START(PROFILER_MULTIPLAYER_SYNC);
     Multiplayer_Sync_Update();
+    PROFILER_STOP(PROFILER_MULTIPLAYER_SYNC);
 }
@@ -14,7 +14,8 @@ typedef const char* (*Message_GetText_proc)(void* param_1, u32 offset);
 #define Message_GetText_addr 0x2DF4B0
 #define Message_GetText ((Message_GetText_proc)Message_GetText_addr)
 
-const MessageEntry* Message_GetCustomEntry(void* param_1, u32 textId) {
+// Returns NULL if there is no custom message with this ID
+const MessageEntry* Message_FindCustomEntry(u32 textId) {
     s32 start;
     s32 end;
 
@@ -31,7 +32,12 @@ const MessageEntry* Message_GetCustomEntry(void* param_1, u32 textId) {
             return (MessageEntry*)&ptrCustomMessageEntries[cur];
         }
     }
-    return Message_GetEntry(param_1, textId);
+    return NULL;
+}
+
+const MessageEntry* Message_GetCustomEntry(void* param_1, u32 textId) {
+    const MessageEntry* entry = Message_FindCustomEntry(textId);
+    return entry != NULL ? entry : Message_GetEntry(param_1, textId);
 }
 
 // compares offset to 0x500000 to detect custom
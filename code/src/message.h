@@ -40,4 +40,6 @@ typedef struct {
     u32  unk_0C;
 } MessageFileHeader;
 
+const MessageEntry* Message_FindCustomEntry(u32 textId);
+
 #endif //_MESSAGE_H_
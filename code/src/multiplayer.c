@@ -3,11 +3,16 @@
 #include "3ds/result.h"
 #include "multiplayer.h"
 #include "multiplayer_ghosts.h"
+#include "multiplayer_spectator.h"
 #include "oot_malloc.h"
 #include "common.h"
 #include "item_effect.h"
+#include "item_table.h"
 #include "savefile.h"
 #include "settings.h"
+#include "spoiler_data.h"
+#include "profiler.h"
+#include "clock.h"
 #include "giants_knife.h"
 
 #include "web.h"
@@ -32,6 +37,66 @@ bool mp_completeSyncs[6];
 bool mSaveContextInit = false;
 // Shared Progress: The ID that this client fullsyncs with
 static u16 fullSyncerID = 0;
+// Shared progress packets received while the in-game menu is open are held here and applied when
+// the menu closes. Each entry is a header word (sender ID, size in words) followed by the packet.
+// Once it's full, newer deltas aren't taken in, and are asked for again when the menu closes.
+#define MENU_QUEUE_WORDS 0x400
+#define MENU_QUEUE_PACKET_MAX_WORDS 0x40
+static u32 menuQueue[MENU_QUEUE_WORDS];
+static size_t menuQueueUsed = 0;
+static bool menuOpen = false;
+u16 mp_menuQueuedPackets = 0;
+// Shared progress delta packets are numbered per console, and the last ones sent are kept so a player
+// that missed some, or dropped and reconnected, can get them again instead of doing a full sync.
+// Each shared progress packet carries the sender's tag and sequence number in one word after the hash.
+#define DELTA_HISTORY_SIZE 128
+#define DELTA_PACKET_MAX_WORDS 0x10
+#define RESUME_REQUEST_INTERVAL_TICKS (TICKS_PER_SEC / 4)
+typedef struct {
+    u16 seq;
+    u8 words;
+    u32 data[DELTA_PACKET_MAX_WORDS];
+} DeltaHistoryEntry;
+static DeltaHistoryEntry deltaHistory[DELTA_HISTORY_SIZE];
+static u16 localTag = 0;
+static u16 localSeq = 0;
+typedef struct {
+    u16 tag;
+    u16 nodeID;
+    u16 lastSeq;     // Last delta applied, which is where a resume request starts
+    u16 acceptedSeq; // Last delta taken in, it can still be waiting in the menu queue
+    bool needsResume;
+    bool resumeAfterMenu; // Deltas were turned away because the menu queue was full
+    u64 lastRequestTicks;
+} PeerSequence;
+static PeerSequence peerSequences[UDS_MAXNODES];
+static u8 peerCount = 0;
+// Deltas asked for by a resume request are sent a few each frame, so a long replay doesn't overrun the send buffer
+#define RESUME_REPLAY_PACKETS_PER_FRAME 8
+typedef struct {
+    u16 nodeID;
+    u16 nextSeq;
+    u16 lastSeq;
+} ResumeReplay;
+static ResumeReplay resumeReplays[UDS_MAXNODES];
+static u8 resumeReplayCount = 0;
+// Set when the connection dropped mid-session, so the next connection resumes instead of syncing
+static bool reconnecting = false;
+// Player summaries are only sent while a spectator has been heard from recently
+#define SPECTATOR_TIMEOUT_TICKS (TICKS_PER_SEC * 5)
+#define PLAYER_SUMMARY_INTERVAL_TICKS TICKS_PER_SEC
+// Items found for other multiworld players are sent again until the owner confirms them
+#define MULTIWORLD_RESEND_INTERVAL_TICKS TICKS_PER_SEC
+#define MULTIWORLD_RESEND_MAX 4
+static u64 lastMultiworldResendTicks = 0;
+static u16 multiworldResendIndex = 0;
+// Items given by other multiworld players since the game was last saved. They're only confirmed once the
+// save has been written, otherwise resetting before saving would lose them for both players.
+static u32 multiworldUnsaved[MULTIWORLD_MAX_PLAYERS][SAVEFILE_MULTIWORLD_IDX_COUNT];
+// Scenes whose collected checks are refreshed once the flags received for them are in the save context
+static u32 collectedScenesToRefresh[(SPOILER_SCENES_MAX + 31) / 32];
+static u64 lastSpectatorPingTicks = 0;
+static bool spectatorSeen = false;
 
 // Network Vars
 u32* mBuffer;
@@ -43,6 +108,8 @@ static void Multiplayer_Sync_Init();
 static void Multiplayer_Sync_SharedProgress();
 static void Multiplayer_SendPacket(u8 packageSize, u16 targetID);
 static void Multiplayer_UnpackPacket(u16 senderID);
+static void Multiplayer_Send_ResumeRequest(u16 targetID);
+static void Multiplayer_Multiworld_Resend(void);
 
 typedef struct {
     // SaveContext
@@ -197,6 +264,8 @@ static void Multiplayer_Overwrite_gSaveContext(void) {
     for (size_t i = 0; i < EXTINF_SIZE; i++) {
         gExtSaveData.extInf[i] = mSaveContext.extInf[i];
     }
+    // The save flags may have come from another player, so the collected checks are rebuilt from them
+    gExtSaveData.extInf[EXTINF_COLLECTEDCHECKS] = 0;
     for (size_t i = 0; i < SAVEFILE_SCENES_DISCOVERED_IDX_COUNT; i++) {
         gExtSaveData.scenesDiscovered[i] = mSaveContext.scenesDiscovered[i];
     }
@@ -205,6 +274,26 @@ static void Multiplayer_Overwrite_gSaveContext(void) {
     }
 }
 
+static void Multiplayer_RefreshCollectedLater(s16 scene) {
+    if (scene >= 0 && scene < SPOILER_SCENES_MAX) {
+        collectedScenesToRefresh[scene / 32] |= 1 << (scene % 32);
+    }
+}
+
+// For flags that don't belong to a single scene
+static void Multiplayer_RefreshAllCollectedLater(void) {
+    memset(collectedScenesToRefresh, 0xFF, sizeof(collectedScenesToRefresh));
+}
+
+static void Multiplayer_RefreshCollected(void) {
+    for (u8 scene = 0; scene < SPOILER_SCENES_MAX; scene++) {
+        if ((collectedScenesToRefresh[scene / 32] >> (scene % 32)) & 1) {
+            SpoilerData_RefreshSceneCollected(scene);
+        }
+    }
+    memset(collectedScenesToRefresh, 0, sizeof(collectedScenesToRefresh));
+}
+
 void Multiplayer_OnFileLoad(void) {
     if (gSettingsContext.mp_Enabled == OFF || gSettingsContext.mp_SharedProgress == OFF) {
         return;
@@ -276,6 +365,12 @@ typedef enum {
     PACKET_BASESYNC,
     PACKET_FULLSCENEFLAGSYNC,
     PACKET_FULLENTRANCESYNC,
+    PACKET_RESUMEREQUEST,
+    PACKET_RESUMEGAP,
+    PACKET_SPECTATORPING,
+    PACKET_PLAYERSUMMARY,
+    PACKET_MULTIWORLDITEM,
+    PACKET_MULTIWORLDACK,
     PACKET_ITEM,
     PACKET_MAXHEALTH,
     PACKET_KOKIRISWORDEQUIP,
@@ -311,10 +406,22 @@ typedef enum {
     PACKET_AMMOCHANGE,
 } PacketIdentifier;
 
-static u8 IsSendReceiveReady(void) {
+static u8 IsConnected(void) {
     return gSettingsContext.mp_Enabled != OFF && netStage >= 3;
 }
 
+// While reconnecting, progress still goes through the send functions so it ends up in the delta history
+static u8 IsSendReceiveReady(void) {
+    return IsConnected() || (gSettingsContext.mp_Enabled != OFF && reconnecting);
+}
+
+static bool IsSequencedPacket(u32 identifier, size_t words) {
+    return identifier >= PACKET_ITEM && identifier != PACKET_ACTORUPDATE && identifier != PACKET_ACTORSPAWN &&
+           words <= DELTA_PACKET_MAX_WORDS;
+}
+
+static u8 netScanChecks = 0;
+
 void Multiplayer_Run(void) {
     if (gSettingsContext.mp_Enabled == OFF) {
         return;
@@ -323,7 +430,6 @@ void Multiplayer_Run(void) {
     Result result;
     static u8 initTimer = 0;
     const u32 wlancommID = 0x3656B7DA; // Unique ID set manually
-    static u8 netScanChecks = 0;
 
     switch (netStage) {
         case 0:
@@ -337,6 +443,11 @@ void Multiplayer_Run(void) {
                 }
                 mBufSize = 0x4000;
                 mBuffer = SystemArena_Malloc(mBufSize);
+                u64 tick = svcGetSystemTick();
+                localTag = (u16)(tick ^ (tick >> 16));
+                if (localTag == 0) {
+                    localTag = 1;
+                }
                 netStage++;
             }
             break;
@@ -396,7 +507,19 @@ void Multiplayer_Run(void) {
             mBufSize = UDS_DATAFRAME_MAXSIZE;
             mBuffer = SystemArena_Malloc(mBufSize);
 
-            if (gSettingsContext.mp_SharedProgress == ON) {
+            if (reconnecting) {
+                reconnecting = false;
+                if (gSettingsContext.mp_Spectator) {
+                    netStage++;
+                    break;
+                }
+                netStage++;
+                // Everyone replays what we missed, and asks for what they missed from us
+                Multiplayer_Send_ResumeRequest(UDS_BROADCAST_NETWORKNODEID);
+                break;
+            }
+
+            if (gSettingsContext.mp_SharedProgress == ON && !gSettingsContext.mp_Spectator) {
                 mp_isSyncing = true;
             }
 
@@ -407,18 +530,63 @@ void Multiplayer_Run(void) {
             // Ready to go! This update is only called in-game with the gfx menu closed
             if (IsInGameOrBossChallenge()) {
                 Multiplayer_Update(1);
+                static u64 lastSummaryTicks = 0;
+                if (spectatorSeen && IsInGame() && Clock_GetTicks() - lastSummaryTicks >= PLAYER_SUMMARY_INTERVAL_TICKS) {
+                    Multiplayer_Send_PlayerSummary();
+                    lastSummaryTicks = Clock_GetTicks();
+                }
+                PROFILER_START(PROFILER_GHOSTS);
                 Multiplayer_Ghosts_DrawAll();
+                PROFILER_STOP(PROFILER_GHOSTS);
             }
             break;
     }
 }
 
+// udsConnectionStatus.status values while part of a network
+#define UDS_STATUS_HOST 0x6
+#define UDS_STATUS_CLIENT 0x9
+
+// Clients go back to scanning when they lose the connection, keeping their progress and delta history
+static bool Multiplayer_CheckConnectionLost(void) {
+    if (!udsWaitConnectionStatusEvent(false, false)) {
+        return false;
+    }
+    udsConnectionStatus status;
+    if (R_FAILED(udsGetConnectionStatus(&status)) || status.status == UDS_STATUS_HOST || status.status == UDS_STATUS_CLIENT) {
+        return false;
+    }
+
+    udsUnbind(&bindctx);
+    udsDisconnectNetwork();
+    SystemArena_Free(mBuffer);
+    mBufSize = 0x4000;
+    mBuffer = SystemArena_Malloc(mBufSize);
+    netScanChecks = 0;
+    netStage = 1;
+    reconnecting = true;
+    // Node IDs are handed out again on the new connection, so the players ask again
+    resumeReplayCount = 0;
+    return true;
+}
+
 void Multiplayer_Update(u8 fromGlobalContextUpdate) {
-    if (!IsSendReceiveReady()) {
+    if (!IsConnected() || Multiplayer_CheckConnectionLost()) {
         return;
     }
     Multiplayer_ReceivePackets();
+    if (spectatorSeen && Clock_GetTicks() - lastSpectatorPingTicks > SPECTATOR_TIMEOUT_TICKS) {
+        spectatorSeen = false;
+    }
+    if (gSettingsContext.mp_Spectator) {
+        Multiplayer_Spectator_Tick();
+        Multiplayer_Send_SpectatorPing();
+        return;
+    }
+    PROFILER_START(PROFILER_GHOSTS);
     Multiplayer_Ghosts_Tick();
+    PROFILER_STOP(PROFILER_GHOSTS);
+    Multiplayer_Multiworld_Resend();
     if (fromGlobalContextUpdate) {
         Multiplayer_Send_GhostData();
     } else {
@@ -426,6 +594,13 @@ void Multiplayer_Update(u8 fromGlobalContextUpdate) {
     }
 }
 
+MultiplayerStatus Multiplayer_GetStatus(void) {
+    if (netStage < 0) {
+        return MP_STATUS_OFFLINE;
+    }
+    return IsConnected() ? MP_STATUS_CONNECTED : MP_STATUS_CONNECTING;
+}
+
 s8 Multiplayer_PlayerCount() {
     udsConnectionStatus status;
     if (R_SUCCEEDED(udsGetConnectionStatus(&status))) {
@@ -837,8 +1012,9 @@ static void Multiplayer_Sync_SharedProgress(void) {
 
     // Extra Info Table
     for (size_t index = 0; index < ARRAY_SIZE(gExtSaveData.extInf); index++) {
-        // Don't send this to allow all current players to watch the cutscene
-        if (index == EXTINF_HASTIMETRAVELED) {
+        // Don't send this to allow all current players to watch the cutscene. The collected checks are
+        // kept by every player on their own.
+        if (index == EXTINF_HASTIMETRAVELED || index == EXTINF_COLLECTEDCHECKS) {
             continue;
         }
         if (prevExtInf[index] != gExtSaveData.extInf[index]) {
@@ -936,6 +1112,7 @@ static u8 PrepareSharedProgressPacket(u8 packetIdentifier) {
     for (size_t i = 0; i < ARRAY_SIZE(gSettingsContext.hashIndexes); i++) {
         mBuffer[memSpacer++] = gSettingsContext.hashIndexes[i];
     }
+    memSpacer++; // Tag and sequence number, filled in when sending
 
     return memSpacer;
 }
@@ -947,18 +1124,15 @@ static u8 GetSharedProgressMemSpacerOffset(void) {
     memSpacerOffset++; // Identifier
     memSpacerOffset++; // Sync Id
     memSpacerOffset += ARRAY_SIZE(gSettingsContext.hashIndexes);
+    memSpacerOffset++; // Tag and sequence number
 
     return memSpacerOffset;
 }
 
-// This function should only be called inside shared-progress-receive functions, right after mBuffer has been filled.
-static bool IsInSameSyncGroup(void) {
-    u8 receivedSyncId = mBuffer[1];
+// Spectators see every sync group, so they only check the hash.
+static bool IsSameSeed(void) {
     u32* receivedHashPtr = &mBuffer[2];
 
-    if (receivedSyncId != gSettingsContext.mp_SyncId) {
-        return false;
-    }
     for (size_t i = 0; i < ARRAY_SIZE(gSettingsContext.hashIndexes); i++) {
         if (receivedHashPtr[i] != gSettingsContext.hashIndexes[i]) {
             return false;
@@ -967,6 +1141,13 @@ static bool IsInSameSyncGroup(void) {
     return true;
 }
 
+// This function should only be called inside shared-progress-receive functions, right after mBuffer has been filled.
+static bool IsInSameSyncGroup(void) {
+    u8 receivedSyncId = mBuffer[1];
+
+    return receivedSyncId == gSettingsContext.mp_SyncId && IsSameSeed();
+}
+
 u8 Multiplayer_GetNeededPacketsMask(void) {
     u8 neededPacketsMask = 0;
 
@@ -1250,6 +1431,112 @@ void Multiplayer_Receive_FullEntranceSync(u16 senderID) {
     mp_completeSyncs[5] = true;
 }
 
+// Asks for the delta packets sent after the last one received from each known player
+static void Multiplayer_Send_ResumeRequest(u16 targetID) {
+    if (!IsSendReceiveReady()) {
+        return;
+    }
+    memset(mBuffer, 0, mBufSize);
+    u8 memSpacer = PrepareSharedProgressPacket(PACKET_RESUMEREQUEST);
+
+    mBuffer[memSpacer++] = peerCount;
+    for (size_t i = 0; i < peerCount; i++) {
+        mBuffer[memSpacer++] = peerSequences[i].tag << 16 | peerSequences[i].lastSeq;
+    }
+    Multiplayer_SendPacket(memSpacer, targetID);
+}
+
+static void Multiplayer_Send_ResumeGap(u16 targetID) {
+    if (!IsSendReceiveReady() || gSettingsContext.mp_SharedProgress == OFF) {
+        return;
+    }
+    memset(mBuffer, 0, mBufSize);
+    u8 memSpacer = PrepareSharedProgressPacket(PACKET_RESUMEGAP);
+
+    Multiplayer_SendPacket(memSpacer, targetID);
+}
+
+static void Multiplayer_QueueResumeReplay(u16 nodeID, u16 firstSeq, u16 lastSeq) {
+    ResumeReplay* replay = NULL;
+    for (size_t i = 0; i < resumeReplayCount; i++) {
+        if (resumeReplays[i].nodeID == nodeID) {
+            replay = &resumeReplays[i];
+            break;
+        }
+    }
+    if (replay == NULL) {
+        if (resumeReplayCount >= ARRAY_SIZE(resumeReplays)) {
+            return;
+        }
+        replay = &resumeReplays[resumeReplayCount++];
+        replay->nodeID = nodeID;
+    }
+    // A newer request from the same player starts over from what that player has now
+    replay->nextSeq = firstSeq;
+    replay->lastSeq = lastSeq;
+}
+
+static void Multiplayer_SendResumeReplays(void) {
+    u8 sent = 0;
+    size_t i = 0;
+    while (i < resumeReplayCount && sent < RESUME_REPLAY_PACKETS_PER_FRAME) {
+        ResumeReplay* replay = &resumeReplays[i];
+        DeltaHistoryEntry* historyEntry = &deltaHistory[replay->nextSeq % DELTA_HISTORY_SIZE];
+        bool done = (s16)(replay->nextSeq - replay->lastSeq) > 0;
+        // Newer deltas took the place of the rest in the history while the replay was waiting
+        if (!done && historyEntry->seq != replay->nextSeq) {
+            Multiplayer_Send_ResumeGap(replay->nodeID);
+            done = true;
+        }
+        if (done) {
+            resumeReplays[i] = resumeReplays[--resumeReplayCount];
+            continue;
+        }
+        udsSendTo(replay->nodeID, data_channel, UDS_SENDFLAG_Default, historyEntry->data, historyEntry->words * sizeof(u32));
+        replay->nextSeq++;
+        sent++;
+    }
+}
+
+void Multiplayer_Receive_ResumeRequest(u16 senderID) {
+    if (!IsInSameSyncGroup()) {
+        return;
+    }
+    u8 memSpacer = GetSharedProgressMemSpacerOffset();
+
+    u8 count = mBuffer[memSpacer++];
+    for (size_t i = 0; i < count && i < UDS_MAXNODES; i++) {
+        u32 entry = mBuffer[memSpacer++];
+        if (entry >> 16 != localTag) {
+            continue;
+        }
+
+        u16 lastSeq = entry & 0xFFFF;
+        s16 missing = localSeq - lastSeq;
+        if (missing <= 0) {
+            return;
+        }
+        // Too old for the history, the player needs a full sync instead
+        if (missing > DELTA_HISTORY_SIZE) {
+            Multiplayer_Send_ResumeGap(senderID);
+            return;
+        }
+        Multiplayer_QueueResumeReplay(senderID, lastSeq + 1, localSeq);
+        return;
+    }
+}
+
+void Multiplayer_Receive_ResumeGap(u16 senderID) {
+    if (!IsInSameSyncGroup() || gSettingsContext.mp_SharedProgress == OFF || mp_isSyncing) {
+        return;
+    }
+
+    memset(mp_completeSyncs, 0, sizeof(mp_completeSyncs));
+    fullSyncerID = senderID;
+    mp_foundSyncer = true;
+    mp_isSyncing = true;
+}
+
 void Multiplayer_Send_Item(u8 slot, ItemID item) {
     if (!IsSendReceiveReady() || gSettingsContext.mp_SharedProgress == OFF) {
         return;
@@ -1729,6 +2016,7 @@ void Multiplayer_Receive_EventChkInfBit(u16 senderID) {
         mSaveContext.eventChkInf[index] &= ~(1 << bit);
         prevEventChkInf[index] &= ~(1 << bit);
     }
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_ItemGetInfBit(u8 index, u8 bit, u8 setOrUnset) {
@@ -1761,6 +2049,7 @@ void Multiplayer_Receive_ItemGetInfBit(u16 senderID) {
         mSaveContext.itemGetInf[index] &= ~(1 << bit);
         prevItemGetInf[index] &= ~(1 << bit);
     }
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_InfTableBit(u8 index, u8 bit, u8 setOrUnset) {
@@ -1793,6 +2082,7 @@ void Multiplayer_Receive_InfTableBit(u16 senderID) {
         mSaveContext.infTable[index] &= ~(1 << bit);
         prevInfTable[index] &= ~(1 << bit);
     }
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_ActorFlagBit(u8 member, u8 bit, u8 setOrUnset) {
@@ -1898,6 +2188,7 @@ void Multiplayer_Receive_ActorFlagBit(u16 senderID) {
             }
             break;
     }
+    Multiplayer_RefreshCollectedLater(scene);
 }
 
 void Multiplayer_Send_SceneFlagBit(u8 scene, u8 member, u8 bit, u8 setOrUnset) {
@@ -1954,6 +2245,7 @@ void Multiplayer_Receive_SceneFlagBit(u16 senderID) {
             }
             break;
     }
+    Multiplayer_RefreshCollectedLater(scene);
 }
 
 void Multiplayer_Send_GSFlagBit(u8 index, u8 bit, u8 setOrUnset) {
@@ -1986,6 +2278,7 @@ void Multiplayer_Receive_GSFlagBit(u16 senderID) {
         mSaveContext.gsFlags[index] &= ~(1 << bit);
         prevGSFlags[index] &= ~(1 << bit);
     }
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_BigPoePoints(u32 pointDiff) {
@@ -2009,6 +2302,7 @@ void Multiplayer_Receive_BigPoePoints(u16 senderID) {
 
     mSaveContext.bigPoePoints += pointDiff;
     prevBigPoePoints += pointDiff;
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_FishingFlag(u8 bit, u8 setOrUnset) {
@@ -2039,6 +2333,7 @@ void Multiplayer_Receive_FishingFlag(u16 senderID) {
         mSaveContext.fishingFlags &= ~(1 << bit);
         prevFishingFlags &= ~(1 << bit);
     }
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_WorldMapBit(u8 bit, u8 setOrUnset) {
@@ -2101,6 +2396,7 @@ void Multiplayer_Receive_ExtInfBit(u16 senderID) {
         mSaveContext.extInf[index] &= ~(1 << bit);
         prevExtInf[index] &= ~(1 << bit);
     }
+    Multiplayer_RefreshAllCollectedLater();
 }
 
 void Multiplayer_Send_DiscoveredScene(u32 index, u32 bit) {
@@ -2409,6 +2705,189 @@ void Multiplayer_Receive_ActorSpawn(u16 senderID) {
         rcvdPosRot.rot.x, rcvdPosRot.rot.y, rcvdPosRot.rot.z, params);
 }
 
+// Spectators
+
+void Multiplayer_Send_SpectatorPing(void) {
+    if (!IsSendReceiveReady()) {
+        return;
+    }
+    memset(mBuffer, 0, mBufSize);
+    u8 memSpacer = PrepareSharedProgressPacket(PACKET_SPECTATORPING);
+
+    Multiplayer_SendPacket(memSpacer, UDS_BROADCAST_NETWORKNODEID);
+}
+
+void Multiplayer_Receive_SpectatorPing(u16 senderID) {
+    if (!IsSameSeed()) {
+        return;
+    }
+
+    lastSpectatorPingTicks = Clock_GetTicks();
+    spectatorSeen = true;
+}
+
+void Multiplayer_Send_PlayerSummary(void) {
+    if (!IsSendReceiveReady() || gSettingsContext.mp_Spectator) {
+        return;
+    }
+    memset(mBuffer, 0, mBufSize);
+    u8 memSpacer = PrepareSharedProgressPacket(PACKET_PLAYERSUMMARY);
+
+    PlayerSummary summary = { 0 };
+    summary.currentScene = gGlobalContext->sceneNum;
+    summary.age = gSaveContext.linkAge;
+    summary.syncId = gSettingsContext.mp_SyncId;
+    summary.health = gSaveContext.health;
+    summary.healthCapacity = gSaveContext.healthCapacity;
+    summary.equipment = gSaveContext.equipment;
+    summary.gsTokens = gSaveContext.gsTokens;
+    summary.upgrades = gSaveContext.upgrades;
+    summary.questItems = gSaveContext.questItems;
+    memcpy(summary.collected, gExtSaveData.collectedChecks, sizeof(summary.collected));
+    memcpy(&mBuffer[memSpacer], &summary, sizeof(PlayerSummary));
+    memSpacer += sizeof(PlayerSummary) / 4;
+    Multiplayer_SendPacket(memSpacer, UDS_BROADCAST_NETWORKNODEID);
+}
+
+void Multiplayer_Receive_PlayerSummary(u16 senderID) {
+    if (!gSettingsContext.mp_Spectator || !IsSameSeed()) {
+        return;
+    }
+    u8 memSpacer = GetSharedProgressMemSpacerOffset();
+
+    PlayerSummary summary;
+    memcpy(&summary, &mBuffer[memSpacer], sizeof(PlayerSummary));
+    Multiplayer_Spectator_UpdatePlayer(senderID, &summary);
+}
+
+// Multiworld
+
+static u8 IsBitSet(const u32* bits, s32 index) {
+    return (bits[index / 32] >> (index % 32)) & 1;
+}
+
+static void Multiplayer_Send_MultiworldItem(s32 overrideIndex) {
+    ItemOverride override = ItemOverride_GetByIndex(overrideIndex);
+    if (!IsSendReceiveReady() || override.key.all == 0) {
+        return;
+    }
+    memset(mBuffer, 0, mBufSize);
+    u8 memSpacer = PrepareSharedProgressPacket(PACKET_MULTIWORLDITEM);
+
+    mBuffer[memSpacer++] = gSettingsContext.mw_PlayerId | (override.value.player << 8);
+    mBuffer[memSpacer++] = override.key.all;
+    mBuffer[memSpacer++] = override.value.itemId;
+    Multiplayer_SendPacket(memSpacer, UDS_BROADCAST_NETWORKNODEID);
+}
+
+// Called when an item for another player is collected. It stays in the outbox until the owner confirms it.
+void Multiplayer_Multiworld_SendItem(s32 overrideIndex) {
+    if (overrideIndex < 0) {
+        return;
+    }
+    gExtSaveData.multiworldOutbox[overrideIndex / 32] |= 1 << (overrideIndex % 32);
+    Multiplayer_Send_MultiworldItem(overrideIndex);
+}
+
+static void Multiplayer_Multiworld_Resend(void) {
+    if (gSettingsContext.mw_Players <= 1 || !IsInGame() ||
+        Clock_GetTicks() - lastMultiworldResendTicks < MULTIWORLD_RESEND_INTERVAL_TICKS) {
+        return;
+    }
+    lastMultiworldResendTicks = Clock_GetTicks();
+
+    u8 sent = 0;
+    for (u16 i = 0; i < ITEM_OVERRIDES_MAX && sent < MULTIWORLD_RESEND_MAX; i++) {
+        s32 index = (multiworldResendIndex + i) % ITEM_OVERRIDES_MAX;
+        if (IsBitSet(gExtSaveData.multiworldOutbox, index)) {
+            Multiplayer_Send_MultiworldItem(index);
+            sent++;
+            multiworldResendIndex = index + 1;
+        }
+    }
+}
+
+static void Multiplayer_Send_MultiworldAck(u8 toPlayer, ItemOverride_Key key) {
+    if (!IsSendReceiveReady()) {
+        return;
+    }
+    memset(mBuffer, 0, mBufSize);
+    u8 memSpacer = PrepareSharedProgressPacket(PACKET_MULTIWORLDACK);
+
+    mBuffer[memSpacer++] = gSettingsContext.mw_PlayerId | (toPlayer << 8);
+    mBuffer[memSpacer++] = key.all;
+    Multiplayer_SendPacket(memSpacer, UDS_BROADCAST_NETWORKNODEID);
+}
+
+// Called once an item from another player has been given. The key still has the sender in its padding byte.
+// The sender is told after the next save.
+void Multiplayer_Multiworld_OnItemReceived(u8 fromPlayer, ItemOverride_Key key) {
+    key.pad_ = 0;
+    s32 index = ItemOverride_GetIndex(key);
+    if (index >= 0 && fromPlayer != 0 && fromPlayer <= MULTIWORLD_MAX_PLAYERS) {
+        gExtSaveData.multiworldReceived[fromPlayer - 1][index / 32] |= 1 << (index % 32);
+        multiworldUnsaved[fromPlayer - 1][index / 32] |= 1 << (index % 32);
+    }
+}
+
+// Called once the ext save has been written. Items that were given before a reset aren't in it, and get
+// sent again by their owners.
+void Multiplayer_Multiworld_OnSaved(void) {
+    for (u8 player = 0; player < MULTIWORLD_MAX_PLAYERS; player++) {
+        for (s32 index = 0; index < ITEM_OVERRIDES_MAX; index++) {
+            if (IsBitSet(multiworldUnsaved[player], index) &&
+                IsBitSet(gExtSaveData.multiworldReceived[player], index)) {
+                Multiplayer_Send_MultiworldAck(player + 1, ItemOverride_GetByIndex(index).key);
+            }
+        }
+    }
+    memset(multiworldUnsaved, 0, sizeof(multiworldUnsaved));
+}
+
+void Multiplayer_Receive_MultiworldItem(u16 senderID) {
+    if (gSettingsContext.mw_Players <= 1 || !IsSameSeed() || !IsInGame()) {
+        return;
+    }
+    u8 memSpacer = GetSharedProgressMemSpacerOffset();
+
+    u8 fromPlayer = mBuffer[memSpacer] & 0xFF;
+    u8 toPlayer = (mBuffer[memSpacer++] >> 8) & 0xFF;
+    ItemOverride_Key key = { .all = mBuffer[memSpacer++] };
+    u16 itemId = mBuffer[memSpacer++];
+
+    if (toPlayer != gSettingsContext.mw_PlayerId || fromPlayer == 0 || fromPlayer > MULTIWORLD_MAX_PLAYERS ||
+        ItemTable_GetItemRow(itemId) == NULL) {
+        return;
+    }
+    // Already given. It's confirmed again in case the confirmation was lost, unless it hasn't been saved yet.
+    s32 index = ItemOverride_GetIndex(key);
+    if (index >= 0 && IsBitSet(gExtSaveData.multiworldReceived[fromPlayer - 1], index)) {
+        if (!IsBitSet(multiworldUnsaved[fromPlayer - 1], index)) {
+            Multiplayer_Send_MultiworldAck(fromPlayer, key);
+        }
+        return;
+    }
+    ItemOverride_PushMultiworldItem(fromPlayer, key, itemId);
+}
+
+void Multiplayer_Receive_MultiworldAck(u16 senderID) {
+    if (gSettingsContext.mw_Players <= 1 || !IsSameSeed() || !IsInGame()) {
+        return;
+    }
+    u8 memSpacer = GetSharedProgressMemSpacerOffset();
+
+    u8 toPlayer = (mBuffer[memSpacer++] >> 8) & 0xFF;
+    ItemOverride_Key key = { .all = mBuffer[memSpacer++] };
+
+    if (toPlayer != gSettingsContext.mw_PlayerId) {
+        return;
+    }
+    s32 index = ItemOverride_GetIndex(key);
+    if (index >= 0) {
+        gExtSaveData.multiworldOutbox[index / 32] &= ~(1 << (index % 32));
+    }
+}
+
 // Etc
 
 void Multiplayer_Send_HealthChange(s16 diff) {
@@ -2560,14 +3039,171 @@ void Multiplayer_Receive_AmmoChange(u16 senderID) {
 // Send & Receive
 
 static void Multiplayer_SendPacket(u8 packageSize, u16 targetID) {
+    if (mBuffer[0] >= PACKET_FULLSYNCREQUEST) {
+        u8 seqSpacer = GetSharedProgressMemSpacerOffset() - 1;
+        if (IsSequencedPacket(mBuffer[0], packageSize)) {
+            localSeq++;
+            mBuffer[seqSpacer] = localTag << 16 | localSeq;
+            DeltaHistoryEntry* entry = &deltaHistory[localSeq % DELTA_HISTORY_SIZE];
+            entry->seq = localSeq;
+            entry->words = packageSize;
+            memcpy(entry->data, mBuffer, packageSize * sizeof(mBuffer[0]));
+        } else {
+            // Other packets carry the latest sequence number, so receivers notice when they're behind
+            mBuffer[seqSpacer] = localTag << 16 | localSeq;
+        }
+    }
+    // Spectators never send anything but their keepalive
+    if (!IsConnected() || (gSettingsContext.mp_Spectator && mBuffer[0] != PACKET_SPECTATORPING)) {
+        return;
+    }
     udsSendTo(targetID, data_channel, UDS_SENDFLAG_Default, mBuffer, packageSize * sizeof(mBuffer[0]));
 }
 
-void Multiplayer_ReceivePackets() {
-    if (!IsSendReceiveReady()) {
+static PeerSequence* Multiplayer_FindPeerSequence(u16 tag) {
+    for (size_t i = 0; i < peerCount; i++) {
+        if (peerSequences[i].tag == tag) {
+            return &peerSequences[i];
+        }
+    }
+    return NULL;
+}
+
+static PeerSequence* Multiplayer_GetPeerSequence(u16 tag, u16 seq, bool* isNew) {
+    *isNew = false;
+    PeerSequence* peer = Multiplayer_FindPeerSequence(tag);
+    if (peer != NULL) {
+        return peer;
+    }
+    if (peerCount >= ARRAY_SIZE(peerSequences)) {
+        return NULL;
+    }
+    peer = &peerSequences[peerCount++];
+    memset(peer, 0, sizeof(PeerSequence));
+    peer->tag = tag;
+    peer->lastSeq = seq;
+    peer->acceptedSeq = seq;
+    *isNew = true;
+    return peer;
+}
+
+// Always leaves room for the biggest packet, so anything that's queued fits
+static bool Multiplayer_MenuQueueFull(void) {
+    return menuOpen && menuQueueUsed + 1 + MENU_QUEUE_PACKET_MAX_WORDS > MENU_QUEUE_WORDS;
+}
+
+static void Multiplayer_RequestResume(PeerSequence* peer) {
+    // The replay would only be turned away again, so wait for the menu to close
+    if (Multiplayer_MenuQueueFull()) {
+        peer->resumeAfterMenu = true;
         return;
     }
+    u64 ticks = Clock_GetTicks();
+    if (ticks - peer->lastRequestTicks >= RESUME_REQUEST_INTERVAL_TICKS) {
+        peer->needsResume = true;
+        peer->lastRequestTicks = ticks;
+    }
+}
+
+// Returns false if the packet in mBuffer was already taken in, or is ahead of a missing one and has to wait for
+// the replay. Packets from players never seen before are taken as they are, the full sync covers what came before.
+static bool Multiplayer_CheckSequence(u16 senderID, size_t size) {
+    if (mBuffer[0] < PACKET_FULLSYNCREQUEST || !IsInSameSyncGroup()) {
+        return true;
+    }
+    u32 seqWord = mBuffer[GetSharedProgressMemSpacerOffset() - 1];
+    u16 tag = seqWord >> 16;
+    u16 seq = seqWord & 0xFFFF;
+    if (tag == localTag) {
+        return true;
+    }
+    bool isNew;
+    PeerSequence* peer = Multiplayer_GetPeerSequence(tag, seq, &isNew);
+    if (peer == NULL) {
+        return true;
+    }
+    peer->nodeID = senderID;
+    bool sequenced = IsSequencedPacket(mBuffer[0], (size + sizeof(u32) - 1) / sizeof(u32));
+    if (isNew) {
+        // This packet itself still has to be applied
+        if (sequenced) {
+            peer->lastSeq = seq - 1;
+        }
+        return true;
+    }
+
+    s16 ahead = seq - peer->acceptedSeq;
+    // The base sync already includes everything the syncer had sent
+    if (mBuffer[0] == PACKET_BASESYNC && !mp_completeSyncs[0]) {
+        peer->lastSeq = seq;
+        peer->acceptedSeq = seq;
+        return true;
+    }
+    if (!sequenced) {
+        if (ahead > 0) {
+            Multiplayer_RequestResume(peer);
+        }
+        return true;
+    }
+    if (ahead <= 0) {
+        return false;
+    }
+    if (ahead == 1 && !Multiplayer_MenuQueueFull()) {
+        peer->acceptedSeq = seq;
+        return true;
+    }
+    Multiplayer_RequestResume(peer);
+    return false;
+}
+
+// Unpacks the packet in mBuffer. A delta only moves the sender's sequence on once it's been applied, so a
+// resume request never skips one that's still queued.
+static void Multiplayer_ApplyPacket(u16 senderID, size_t words) {
+    PeerSequence* peer = NULL;
+    u16 seq = 0;
+    if (mBuffer[0] >= PACKET_FULLSYNCREQUEST && IsSequencedPacket(mBuffer[0], words) && IsInSameSyncGroup()) {
+        u32 seqWord = mBuffer[GetSharedProgressMemSpacerOffset() - 1];
+        seq = seqWord & 0xFFFF;
+        peer = Multiplayer_FindPeerSequence(seqWord >> 16);
+    }
+    Multiplayer_UnpackPacket(senderID);
+    if (peer != NULL && (s16)(seq - peer->lastSeq) > 0) {
+        peer->lastSeq = seq;
+    }
+}
 
+static void Multiplayer_UnpackMenuQueue(void) {
+    size_t offset = 0;
+    while (offset < menuQueueUsed) {
+        u16 senderID = menuQueue[offset] & 0xFFFF;
+        size_t words = menuQueue[offset] >> 16;
+        offset++;
+        memset(mBuffer, 0, mBufSize);
+        memcpy(mBuffer, &menuQueue[offset], words * sizeof(u32));
+        offset += words;
+        Multiplayer_ApplyPacket(senderID, words);
+    }
+    menuQueueUsed = 0;
+    mp_menuQueuedPackets = 0;
+}
+
+// Returns true if the packet in mBuffer was put in the menu queue instead of being applied
+static bool Multiplayer_QueueMenuPacket(u16 senderID, size_t size) {
+    // Only the progress deltas wait, all of them so they're still applied in the order they were sent. Ghost
+    // data, actor updates and sync packets are handled right away, so other players keep seeing us and can
+    // still sync.
+    size_t words = (size + sizeof(u32) - 1) / sizeof(u32);
+    if (!menuOpen || !IsSequencedPacket(mBuffer[0], words) || words > MENU_QUEUE_PACKET_MAX_WORDS) {
+        return false;
+    }
+    menuQueue[menuQueueUsed++] = senderID | (words << 16);
+    memcpy(&menuQueue[menuQueueUsed], mBuffer, words * sizeof(u32));
+    menuQueueUsed += words;
+    mp_menuQueuedPackets++;
+    return true;
+}
+
+static void Multiplayer_BeginReceive(void) {
     if (gSettingsContext.mp_SharedProgress == ON && IsInGame()) {
         gSaveContext.sceneFlags[gGlobalContext->sceneNum].swch = gGlobalContext->actorCtx.flags.swch;
         gSaveContext.sceneFlags[gGlobalContext->sceneNum].chest = gGlobalContext->actorCtx.flags.chest;
@@ -2575,6 +3211,45 @@ void Multiplayer_ReceivePackets() {
         gSaveContext.sceneFlags[gGlobalContext->sceneNum].collect = gGlobalContext->actorCtx.flags.collect;
         Multiplayer_Overwrite_mSaveContext();
     }
+}
+
+static void Multiplayer_EndReceive(void) {
+    if (gSettingsContext.mp_SharedProgress == ON && IsInGame()) {
+        Multiplayer_Overwrite_gSaveContext();
+        Multiplayer_RefreshCollected();
+    }
+}
+
+void Multiplayer_OnMenuOpen(void) {
+    menuOpen = true;
+}
+
+// The queue is applied even if the connection dropped while the menu was open, since the packets in it
+// already count as received
+void Multiplayer_OnMenuClose(void) {
+    menuOpen = false;
+    if (menuQueueUsed != 0) {
+        Multiplayer_BeginReceive();
+        Multiplayer_UnpackMenuQueue();
+        Multiplayer_EndReceive();
+    }
+
+    // Ask for the deltas that didn't fit, starting after the last one that was just applied
+    for (size_t i = 0; i < peerCount; i++) {
+        if (peerSequences[i].resumeAfterMenu) {
+            peerSequences[i].resumeAfterMenu = false;
+            peerSequences[i].needsResume = true;
+            peerSequences[i].lastRequestTicks = Clock_GetTicks();
+        }
+    }
+}
+
+void Multiplayer_ReceivePackets() {
+    if (!IsConnected()) {
+        return;
+    }
+
+    Multiplayer_BeginReceive();
 
     mp_receivedPackets = 0;
     size_t actual_size = 0;
@@ -2582,14 +3257,21 @@ void Multiplayer_ReceivePackets() {
         memset(mBuffer, 0, mBufSize);
         u16 src_NetworkNodeID = 0;
         udsPullPacket(&bindctx, mBuffer, mBufSize, &actual_size, &src_NetworkNodeID);
-        if (actual_size) {
-            Multiplayer_UnpackPacket(src_NetworkNodeID);
+        if (actual_size && Multiplayer_CheckSequence(src_NetworkNodeID, actual_size) &&
+            !Multiplayer_QueueMenuPacket(src_NetworkNodeID, actual_size)) {
+            Multiplayer_ApplyPacket(src_NetworkNodeID, (actual_size + sizeof(u32) - 1) / sizeof(u32));
         }
     } while (actual_size);
 
-    if (gSettingsContext.mp_SharedProgress == ON && IsInGame()) {
-        Multiplayer_Overwrite_gSaveContext();
+    for (size_t i = 0; i < peerCount; i++) {
+        if (peerSequences[i].needsResume) {
+            peerSequences[i].needsResume = false;
+            Multiplayer_Send_ResumeRequest(peerSequences[i].nodeID);
+        }
     }
+    Multiplayer_SendResumeReplays();
+
+    Multiplayer_EndReceive();
 }
 
 static void Multiplayer_UnpackPacket(u16 senderID) {
@@ -2608,6 +3290,12 @@ static void Multiplayer_UnpackPacket(u16 senderID) {
         Multiplayer_Receive_BaseSync,
         Multiplayer_Receive_FullSceneFlagSync,
         Multiplayer_Receive_FullEntranceSync,
+        Multiplayer_Receive_ResumeRequest,
+        Multiplayer_Receive_ResumeGap,
+        Multiplayer_Receive_SpectatorPing,
+        Multiplayer_Receive_PlayerSummary,
+        Multiplayer_Receive_MultiworldItem,
+        Multiplayer_Receive_MultiworldAck,
         Multiplayer_Receive_Item,
         Multiplayer_Receive_MaxHealth,
         Multiplayer_Receive_KokiriSwordEquip,
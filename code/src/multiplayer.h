@@ -3,6 +3,7 @@
 
 #include "3ds/types.h"
 #include "z3D/z3D.h"
+#include "item_override.h"
 
 extern u32 mp_receivedPackets;
 extern bool mp_duplicateSendProtection;
@@ -10,18 +11,35 @@ extern bool mp_isSyncing;
 extern bool mp_foundSyncer;
 extern bool mp_completeSyncs[6];
 extern bool mSaveContextInit;
+extern u16 mp_menuQueuedPackets;
+
+typedef enum {
+    MP_STATUS_CONNECTING,
+    MP_STATUS_CONNECTED,
+    MP_STATUS_OFFLINE,
+} MultiplayerStatus;
 
 void Multiplayer_Run(void);
 void Multiplayer_Update(u8 fromGlobalContextUpdate);
+MultiplayerStatus Multiplayer_GetStatus(void);
 s8 Multiplayer_PlayerCount();
 void Multiplayer_Sync_Update(void);
 void Multiplayer_ReceivePackets();
 void Multiplayer_OnFileLoad(void);
+void Multiplayer_OnMenuOpen(void);
+void Multiplayer_OnMenuClose(void);
 
 // Ghost Data
 void Multiplayer_Send_GhostPing(void);
 void Multiplayer_Send_GhostData(void);
 void Multiplayer_Send_LinkSFX(u32 sfxID);
+// Spectators
+void Multiplayer_Send_SpectatorPing(void);
+void Multiplayer_Send_PlayerSummary(void);
+// Multiworld
+void Multiplayer_Multiworld_SendItem(s32 overrideIndex);
+void Multiplayer_Multiworld_OnItemReceived(u8 fromPlayer, ItemOverride_Key key);
+void Multiplayer_Multiworld_OnSaved(void);
 // Shared Progress
 u8 Multiplayer_GetNeededPacketsMask(void);
 void Multiplayer_Send_FullSyncRequest(u8 neededPacketsMask);
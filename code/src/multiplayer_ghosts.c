@@ -1,6 +1,6 @@
 #include "multiplayer_ghosts.h"
-#include "3ds/svc.h"
 #include "common.h"
+#include "clock.h"
 
 typedef struct {
     bool inUse;
@@ -14,7 +14,7 @@ static LinkGhost ghosts[16];
 #define INACTIVE_TIME_LIMIT (TICKS_PER_SEC * 3)
 
 void Multiplayer_Ghosts_Tick(void) {
-    u64 currentTick = svcGetSystemTick();
+    u64 currentTick = Clock_GetTicks();
     for (size_t i = 0; i < ARRAY_SIZE(ghosts); i++) {
         LinkGhost* ghost = &ghosts[i];
         if (ghost->inUse && currentTick - ghost->lastTick > INACTIVE_TIME_LIMIT) {
@@ -50,7 +50,7 @@ void Multiplayer_Ghosts_UpdateGhost(u16 networkID, GhostData* ghostData) {
         return;
     }
     // Set vars
-    ghostX->lastTick = svcGetSystemTick();
+    ghostX->lastTick = Clock_GetTicks();
     if (ghostData != NULL) {
         ghostX->ghostData.currentScene = ghostData->currentScene;
         ghostX->ghostData.age = ghostData->age;
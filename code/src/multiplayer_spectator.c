@@ -0,0 +1,109 @@
+#include "multiplayer_spectator.h"
+#include "common.h"
+#include "clock.h"
+#include <string.h>
+
+typedef struct {
+    bool inUse;
+    u64 lastTick;
+    u16 networkID;
+    PlayerSummary summary;
+} SpectatedPlayer;
+
+static SpectatedPlayer players[16];
+static u8 playerOrder[ARRAY_SIZE(players)];
+static u8 playerCount = 0;
+
+// Summaries are sent once a second, so a player is gone after missing a few
+#define INACTIVE_TIME_LIMIT (TICKS_PER_SEC * 5)
+
+static bool ComesBefore(const SpectatedPlayer* a, const SpectatedPlayer* b) {
+    if (a->summary.syncId != b->summary.syncId) {
+        return a->summary.syncId < b->summary.syncId;
+    }
+    return a->networkID < b->networkID;
+}
+
+static void UpdatePlayerOrder(void) {
+    playerCount = 0;
+    for (u8 i = 0; i < ARRAY_SIZE(players); i++) {
+        if (!players[i].inUse) {
+            continue;
+        }
+        u8 pos = playerCount++;
+        while (pos > 0 && ComesBefore(&players[i], &players[playerOrder[pos - 1]])) {
+            playerOrder[pos] = playerOrder[pos - 1];
+            pos--;
+        }
+        playerOrder[pos] = i;
+    }
+}
+
+void Multiplayer_Spectator_Tick(void) {
+    u64 currentTick = Clock_GetTicks();
+    bool removed = false;
+    for (size_t i = 0; i < ARRAY_SIZE(players); i++) {
+        SpectatedPlayer* player = &players[i];
+        if (player->inUse && currentTick - player->lastTick > INACTIVE_TIME_LIMIT) {
+            player->inUse = false;
+            removed = true;
+        }
+    }
+    if (removed) {
+        UpdatePlayerOrder();
+    }
+}
+
+void Multiplayer_Spectator_UpdatePlayer(u16 networkID, const PlayerSummary* summary) {
+    SpectatedPlayer* playerX = NULL;
+    // Find existing player
+    for (size_t i = 0; i < ARRAY_SIZE(players); i++) {
+        SpectatedPlayer* player = &players[i];
+        if (player->inUse && player->networkID == networkID) {
+            playerX = player;
+            break;
+        }
+    }
+    // Assign new player
+    bool changedOrder = false;
+    if (playerX == NULL) {
+        for (size_t i = 0; i < ARRAY_SIZE(players); i++) {
+            SpectatedPlayer* player = &players[i];
+            if (!player->inUse) {
+                player->inUse = true;
+                player->networkID = networkID;
+                playerX = player;
+                changedOrder = true;
+                break;
+            }
+        }
+    }
+    // Failsafe in case all spots are taken
+    if (playerX == NULL) {
+        return;
+    }
+    changedOrder |= playerX->summary.syncId != summary->syncId;
+
+    playerX->lastTick = Clock_GetTicks();
+    memcpy(&playerX->summary, summary, sizeof(PlayerSummary));
+    if (changedOrder) {
+        UpdatePlayerOrder();
+    }
+}
+
+u8 Multiplayer_Spectator_PlayerCount(void) {
+    return playerCount;
+}
+
+const PlayerSummary* Multiplayer_Spectator_GetPlayer(u8 index, u16* networkID) {
+    if (index >= playerCount) {
+        return NULL;
+    }
+    SpectatedPlayer* player = &players[playerOrder[index]];
+    *networkID = player->networkID;
+    return &player->summary;
+}
+
+u8 Multiplayer_Spectator_IsCollected(const PlayerSummary* summary, u16 itemIndex) {
+    return (summary->collected[itemIndex / 32] >> (itemIndex % 32)) & 1;
+}
@@ -0,0 +1,34 @@
+#ifndef _MULTIPLAYER_SPECTATOR_H_
+#define _MULTIPLAYER_SPECTATOR_H_
+
+#include "3ds/types.h"
+#include "z3D/z3D.h"
+#include "spoiler_data.h"
+
+// Spectators don't play, they only keep a summary of every player's state to show a live tracker.
+// Players send their summary once a second while a spectator on the same seed hash is around.
+
+#define SPECTATOR_COLLECTED_WORDS SPOILER_COLLECTED_WORDS
+
+typedef struct {
+    s16 currentScene;
+    u8 age;
+    u8 syncId;
+    s16 health;
+    u16 healthCapacity;
+    u16 equipment;
+    u16 gsTokens;
+    u32 upgrades;
+    u32 questItems;
+    // One bit per item location, indexed like gSpoilerData.ItemLocations
+    u32 collected[SPECTATOR_COLLECTED_WORDS];
+} PlayerSummary;
+
+void Multiplayer_Spectator_Tick(void);
+void Multiplayer_Spectator_UpdatePlayer(u16 networkID, const PlayerSummary* summary);
+u8 Multiplayer_Spectator_PlayerCount(void);
+/// Players are kept sorted by sync id and network id, so the order doesn't jump around
+const PlayerSummary* Multiplayer_Spectator_GetPlayer(u8 index, u16* networkID);
+u8 Multiplayer_Spectator_IsCollected(const PlayerSummary* summary, u16 itemIndex);
+
+#endif //_MULTIPLAYER_SPECTATOR_H_
@@ -9,4 +9,7 @@
 #define NEWCODE_OFFSET 0x005C7000 //TODO: this 
 #define NEWCODE_SIZE   0x00050000 //TODO: this. even now, this is too big.
 
+// gAutoTracker is linked first in the new code, so tools can always find it here
+#define AUTOTRACKER_OFFSET NEWCODE_OFFSET
+
 #endif //_NEWCODEINFO_H_
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "profiler.h"
+
+#ifdef ENABLE_DEBUG
+
+#include "common.h"
+#include "draw.h"
+#include "savefile.h"
+#include "clock.h"
+#include "3ds/extdata.h"
+#include <string.h>
+
+#define PROFILER_WINDOW_FRAMES 64
+#define PROFILER_SPIKES_MAX 32
+// A frame is a spike when the patch code takes more than a tenth of a 30 fps frame
+#define PROFILER_SPIKE_TICKS (TICKS_PER_SEC / 300)
+#define PROFILER_SPIKES_VERSION 2
+
+#define TicksToMicroseconds(ticks) ((u32)((ticks) / (TICKS_PER_SEC / 1000000)))
+
+typedef struct {
+    u32 frame;
+    s16 sceneNum;
+    s16 entranceIndex;
+    u32 playtimeSeconds;
+    u32 totalUs;
+    u32 subsystemUs[PROFILER_SUBSYSTEM_COUNT];
+} ProfilerSpike;
+
+typedef struct {
+    u32 version;
+    u32 spikeCount; // Total ever recorded, the oldest ones get overwritten
+    ProfilerSpike spikes[PROFILER_SPIKES_MAX];
+} ProfilerSpikeLog;
+
+static const char* subsystemNames[] = {
+    "Item override",
+    " Ice traps",
+    "Models",
+    "Input",
+    "Multiplayer",
+    " Ghosts",
+    "Multiplayer sync",
+    "Gfx update",
+};
+
+static u32 currentFrameTicks[PROFILER_SUBSYSTEM_COUNT];
+static u32 windowTicks[PROFILER_SUBSYSTEM_COUNT][PROFILER_WINDOW_FRAMES];
+static u32 windowTotalTicks[PROFILER_WINDOW_FRAMES];
+static u16 windowPos = 0;
+static u16 windowFrames = 0;
+
+static ProfilerSpikeLog spikeLog = { PROFILER_SPIKES_VERSION, 0 };
+static u32 savedSpikeCount = 0;
+
+void Profiler_Record(ProfilerSubsystem subsystem, u64 ticks) {
+    currentFrameTicks[subsystem] += (u32)ticks;
+}
+
+void Profiler_EndFrame(void) {
+    // Nested subsystems are already part of their parent's time, so they're left out of the total
+    u32 totalTicks = currentFrameTicks[PROFILER_ITEM_OVERRIDE] + currentFrameTicks[PROFILER_MODELS] +
+                     currentFrameTicks[PROFILER_INPUT] + currentFrameTicks[PROFILER_MULTIPLAYER] +
+                     currentFrameTicks[PROFILER_MULTIPLAYER_SYNC] + currentFrameTicks[PROFILER_GFX];
+
+    for (u32 i = 0; i < PROFILER_SUBSYSTEM_COUNT; i++) {
+        windowTicks[i][windowPos] = currentFrameTicks[i];
+    }
+    windowTotalTicks[windowPos] = totalTicks;
+    windowPos = (windowPos + 1) % PROFILER_WINDOW_FRAMES;
+    if (windowFrames < PROFILER_WINDOW_FRAMES) {
+        windowFrames++;
+    }
+
+    if (totalTicks > PROFILER_SPIKE_TICKS && gGlobalContext != NULL) {
+        ProfilerSpike* spike = &spikeLog.spikes[spikeLog.spikeCount % PROFILER_SPIKES_MAX];
+        spike->frame = Clock_GetFrameCount();
+        spike->sceneNum = gGlobalContext->sceneNum;
+        spike->entranceIndex = gSaveContext.entranceIndex;
+        spike->playtimeSeconds = gExtSaveData.playtimeSeconds;
+        spike->totalUs = TicksToMicroseconds(totalTicks);
+        for (u32 i = 0; i < PROFILER_SUBSYSTEM_COUNT; i++) {
+            spike->subsystemUs[i] = TicksToMicroseconds(currentFrameTicks[i]);
+        }
+        spikeLog.spikeCount++;
+    }
+
+    memset(currentFrameTicks, 0, sizeof(currentFrameTicks));
+}
+
+static void Profiler_DrawRow(u32 posY, const char* name, const u32* samples) {
+    u32 min = 0xFFFFFFFF;
+    u32 max = 0;
+    u64 sum = 0;
+    for (u32 i = 0; i < windowFrames; i++) {
+        u32 sample = samples[i];
+        min = sample < min ? sample : min;
+        max = sample > max ? sample : max;
+        sum += sample;
+    }
+    u32 avg = windowFrames > 0 ? (u32)(sum / windowFrames) : 0;
+    if (windowFrames == 0) {
+        min = 0;
+    }
+
+    u32 color = max > PROFILER_SPIKE_TICKS ? COLOR_RED : COLOR_WHITE;
+    Draw_DrawFormattedString_Small(10, posY, color, "%-17s%6d %6d %6d", name,
+        TicksToMicroseconds(min), TicksToMicroseconds(avg), TicksToMicroseconds(max));
+}
+
+void Profiler_Draw(void) {
+    Draw_DrawFormattedString(10, 16, COLOR_TITLE, "Profiler - last %d frames", windowFrames);
+    Draw_DrawFormattedString_Small(10, 16 + SPACING_Y * 2, COLOR_TITLE, "%-17s%6s %6s %6s", "Time (us)", "min", "avg", "max");
+
+    u32 posY = 16 + SPACING_Y * 2 + SPACING_SMALL_Y + 4;
+    for (u32 i = 0; i < PROFILER_SUBSYSTEM_COUNT; i++) {
+        Profiler_DrawRow(posY, subsystemNames[i], windowTicks[i]);
+        posY += SPACING_SMALL_Y + 2;
+    }
+    Profiler_DrawRow(posY + 4, "Total", windowTotalTicks);
+
+    Draw_DrawFormattedString_Small(10, posY + SPACING_SMALL_Y * 3, COLOR_WHITE, "Spikes over %d us: %d (saved to profiler.bin)",
+        TicksToMicroseconds(PROFILER_SPIKE_TICKS), spikeLog.spikeCount);
+}
+
+void Profiler_SaveSpikes(void) {
+    if (spikeLog.spikeCount == savedSpikeCount) {
+        return;
+    }
+
+    FS_Archive fsa;
+    if (R_FAILED(extDataMount(&fsa))) {
+        return;
+    }
+    extDataWriteFileDirectly(fsa, "/profiler.bin", &spikeLog, 0, sizeof(spikeLog));
+    extDataUnmount(fsa);
+    savedSpikeCount = spikeLog.spikeCount;
+}
+
+#endif //ENABLE_DEBUG
@@ -0,0 +1,42 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include "z3D/z3D.h"
+#include "3ds/svc.h"
+
+// Per-frame timings of the patch code, only compiled in debug builds (make debug=1).
+// Times are added up over a frame, so hooks that run more than once per frame are counted in full.
+
+typedef enum {
+    PROFILER_ITEM_OVERRIDE, // Includes the ice trap update
+    PROFILER_ICE_TRAP,
+    PROFILER_MODELS,
+    PROFILER_INPUT,
+    PROFILER_MULTIPLAYER, // Includes the ghosts
+    PROFILER_GHOSTS,
+    PROFILER_MULTIPLAYER_SYNC,
+    PROFILER_GFX,
+    PROFILER_SUBSYSTEM_COUNT,
+} ProfilerSubsystem;
+
+#ifdef ENABLE_DEBUG
+
+#define PROFILER_START(subsystem) u64 profilerStart_##subsystem = svcGetSystemTick()
+#define PROFILER_STOP(subsystem) Profiler_Record(subsystem, svcGetSystemTick() - profilerStart_##subsystem)
+
+void Profiler_Record(ProfilerSubsystem subsystem, u64 ticks);
+/// Moves the times recorded since the last call into the rolling window, and remembers the frame if it was a spike
+void Profiler_EndFrame(void);
+/// Draws the rolling min/avg/max of each subsystem on the bottom screen
+void Profiler_Draw(void);
+/// Writes the spikes recorded so far to the ext data, if there are new ones
+void Profiler_SaveSpikes(void);
+
+#else
+
+#define PROFILER_START(subsystem)
+#define PROFILER_STOP(subsystem)
+
+#endif //ENABLE_DEBUG
+
+#endif //_PROFILER_H_
@@ -5,6 +5,7 @@
 #include "3ds/types.h"
 #include "3ds/extdata.h"
 #include <string.h>
+#include <stddef.h>
 #include "entrance.h"
 #include "multiplayer.h"
 #include "item_override.h"
@@ -262,6 +263,10 @@ void SaveFile_SetSceneDiscovered(u8 sceneNum) {
         return;
     }
 
+    if (sceneNum < SPLIT_DUNGEON_COUNT) {
+        SplitTimer_Record(SPLIT_DUNGEON_ENTERED + sceneNum);
+    }
+
     u16 numBits = sizeof(u32) * 8;
     u32 idx = sceneNum / numBits;
     if (idx < SAVEFILE_SCENES_DISCOVERED_IDX_COUNT) {
@@ -621,6 +626,11 @@ void SaveFile_InitExtSaveData(u32 saveNumber) {
     gExtSaveData.playtimeSeconds = 0;
     memset(&gExtSaveData.scenesDiscovered, 0, sizeof(gExtSaveData.scenesDiscovered));
     memset(&gExtSaveData.entrancesDiscovered, 0, sizeof(gExtSaveData.entrancesDiscovered));
+    memset(&gExtSaveData.splitTimes, 0, sizeof(gExtSaveData.splitTimes));
+    memset(&gExtSaveData.multiworldOutbox, 0, sizeof(gExtSaveData.multiworldOutbox));
+    memset(&gExtSaveData.multiworldReceived, 0, sizeof(gExtSaveData.multiworldReceived));
+    memset(&gExtSaveData.pendingItems, 0, sizeof(gExtSaveData.pendingItems));
+    memset(&gExtSaveData.collectedChecks, 0, sizeof(gExtSaveData.collectedChecks));
     // Ingame Options
     gExtSaveData.option_EnableBGM = gSettingsContext.playMusic;
     gExtSaveData.option_EnableSFX = gSettingsContext.playSFX;
@@ -681,7 +691,30 @@ void SaveFile_SaveExtSaveData(u32 saveNumber) {
 
     path[1] = saveNumber + '0';
 
-    extDataWriteFileDirectly(fsa, path, &gExtSaveData, 0, sizeof(gExtSaveData));
+    u32 written = extDataWriteFileDirectly(fsa, path, &gExtSaveData, 0, sizeof(gExtSaveData));
+
+    extDataUnmount(fsa);
+
+    if (written == sizeof(gExtSaveData)) {
+        Multiplayer_Multiworld_OnSaved();
+    }
+}
+
+// Only writes the split times over the ones already saved, the rest of the ext data has to stay in step with the main save
+void SaveFile_SaveSplitTimes(u32 saveNumber) {
+    char path[] = "/0.bin";
+
+    Result res;
+    FS_Archive fsa;
+
+    if (R_FAILED(res = extDataMount(&fsa))) {
+        return;
+    }
+
+    path[1] = saveNumber + '0';
+
+    extDataWriteFileDirectly(fsa, path, gExtSaveData.splitTimes, offsetof(ExtSaveData, splitTimes),
+                             sizeof(gExtSaveData.splitTimes));
 
     extDataUnmount(fsa);
 }
@@ -2,9 +2,14 @@
 #define _SAVEFILE_H_
 
 #include "z3D/z3D.h"
+#include "split_timer.h"
+#include "item_override.h"
+#include "spoiler_data.h"
 
 #define SAVEFILE_SCENES_DISCOVERED_IDX_COUNT 4
 #define SAVEFILE_ENTRANCES_DISCOVERED_IDX_COUNT 66
+#define SAVEFILE_MULTIWORLD_IDX_COUNT (ITEM_OVERRIDES_MAX / 32)
+#define SAVEFILE_PENDING_ITEMS_MAX 96
 
 u8 SaveFile_GetMedallionCount(void);
 u8 SaveFile_GetStoneCount(void);
@@ -23,16 +28,18 @@ u8 SaveFile_InventoryMenuHasSlot(u8 adult, u8 itemSlot);
 void SaveFile_InitExtSaveData(u32 fileBaseIndex);
 void SaveFile_LoadExtSaveData(u32 saveNumber);
 void SaveFile_SaveExtSaveData(u32 saveNumber);
+void SaveFile_SaveSplitTimes(u32 saveNumber);
 void SaveFile_EnforceHealthLimit(void);
 u8 SaveFile_SwordlessPatchesEnabled(void);
 
 // Increment the version number whenever the ExtSaveData structure is changed
-#define EXTSAVEDATA_VERSION 11
+#define EXTSAVEDATA_VERSION 16
 
 typedef enum {
     EXTINF_BIGGORONTRADES,
     EXTINF_HASTIMETRAVELED,
     EXTINF_MASTERSWORDFLAGS,
+    EXTINF_COLLECTEDCHECKS, // Set once collectedChecks has been filled in from the save flags
     EXTINF_SIZE,
 } ExtInf;
 
@@ -52,6 +59,15 @@ typedef struct {
     u32 playtimeSeconds;
     u32 scenesDiscovered[SAVEFILE_SCENES_DISCOVERED_IDX_COUNT];
     u32 entrancesDiscovered[SAVEFILE_ENTRANCES_DISCOVERED_IDX_COUNT];
+    u32 splitTimes[SPLIT_COUNT];                  // Play time of each split timer event, 0 if it hasn't happened
+    u32 multiworldOutbox[SAVEFILE_MULTIWORLD_IDX_COUNT]; // Items found for other players, by override index, until they confirm them
+    u32 multiworldReceived[MULTIWORLD_MAX_PLAYERS][SAVEFILE_MULTIWORLD_IDX_COUNT]; // Items given from each player, by override index
+    struct {
+        u16 head;
+        u16 count;
+        ItemOverride items[SAVEFILE_PENDING_ITEMS_MAX];
+    } pendingItems; // Ring buffer of items waiting to be given, saved along with the events that queued them
+    u32 collectedChecks[SPOILER_COLLECTED_WORDS]; // Checks collected so far, indexed like gSpoilerData.ItemLocations
     // Ingame Options, all need to be s8
     s8 option_EnableBGM;
     s8 option_EnableSFX;
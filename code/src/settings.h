@@ -332,6 +332,12 @@ typedef enum {
   ICETRAPS_ONSLAUGHT,
 } IceTrapSetting;
 
+typedef enum {
+  ICETRAPDISGUISES_MAJOR,
+  ICETRAPDISGUISES_POOL,
+  ICETRAPDISGUISES_NEARBY,
+} IceTrapDisguisesSetting;
+
 typedef enum {
   GKDURABILITY_VANILLA,
   GKDURABILITY_RANDOMRISK,
@@ -529,6 +535,7 @@ typedef struct {
 
   u8 itemPoolValue;
   u8 iceTrapValue;
+  u8 iceTrapDisguises;
   u8 progressiveGoronSword;
 
   u8 mp_Enabled;
@@ -537,6 +544,9 @@ typedef struct {
   u8 mp_SharedHealth;
   u8 mp_SharedRupees;
   u8 mp_SharedAmmo;
+  u8 mp_Spectator;
+  u8 mw_Players;
+  u8 mw_PlayerId;
 
   u8 zTargeting;
   u8 cameraControl;
@@ -0,0 +1,79 @@
+#include "split_timer.h"
+#include "savefile.h"
+#include "settings.h"
+
+#define GAMEMODE_END_CREDITS 3
+
+void SplitTimer_Record(SplitTimerEvent event) {
+    if (event >= SPLIT_COUNT || gExtSaveData.splitTimes[event] != 0) {
+        return;
+    }
+    // 0 means the event hasn't happened, so anything in the first second counts as 1
+    gExtSaveData.splitTimes[event] = gExtSaveData.playtimeSeconds > 0 ? gExtSaveData.playtimeSeconds : 1;
+}
+
+u32 SplitTimer_GetTime(SplitTimerEvent event) {
+    return gExtSaveData.splitTimes[event];
+}
+
+void SplitTimer_Update(void) {
+    // The game doesn't save after the credits, so write the split straight away or it would be lost.
+    // Only the split times are written, the rest of the ext data is saved along with the main save.
+    if (gSaveContext.gameMode == GAMEMODE_END_CREDITS && SplitTimer_GetTime(SPLIT_GANON_DEFEATED) == 0) {
+        SplitTimer_Record(SPLIT_GANON_DEFEATED);
+        SaveFile_SaveSplitTimes(gSaveContext.fileNum);
+    }
+}
+
+static u8 SplitTimer_GetGoal(SplitTimerGoal* goal, u8 condition, u8 stoneCount, u8 medallionCount, u8 rewardCount,
+                             u8 dungeonCount, u8 tokenCount) {
+    switch (condition) {
+        case RAINBOWBRIDGE_VANILLA:
+            goal->have = ((gSaveContext.questItems >> 3) & 0x1) + ((gSaveContext.questItems >> 4) & 0x1);
+            goal->need = 2;
+            goal->unit = "Spirit/Shadow";
+            return 1;
+        case RAINBOWBRIDGE_STONES:
+            goal->have = SaveFile_GetStoneCount();
+            goal->need = stoneCount;
+            goal->unit = "stones";
+            return 1;
+        case RAINBOWBRIDGE_MEDALLIONS:
+            goal->have = SaveFile_GetMedallionCount();
+            goal->need = medallionCount;
+            goal->unit = "medallions";
+            return 1;
+        case RAINBOWBRIDGE_REWARDS:
+            goal->have = SaveFile_GetStoneCount() + SaveFile_GetMedallionCount();
+            goal->need = rewardCount;
+            goal->unit = "rewards";
+            return 1;
+        case RAINBOWBRIDGE_DUNGEONS:
+            goal->have = SaveFile_GetDungeonCount();
+            goal->need = dungeonCount;
+            goal->unit = "dungeons";
+            return 1;
+        case RAINBOWBRIDGE_TOKENS:
+            goal->have = gSaveContext.gsTokens > 0xFF ? 0xFF : gSaveContext.gsTokens;
+            goal->need = tokenCount;
+            goal->unit = "tokens";
+            return 1;
+    }
+    return 0;
+}
+
+u8 SplitTimer_GetBridgeGoal(SplitTimerGoal* goal) {
+    return SplitTimer_GetGoal(goal, gSettingsContext.rainbowBridge, gSettingsContext.bridgeStoneCount,
+                              gSettingsContext.bridgeMedallionCount, gSettingsContext.bridgeRewardCount,
+                              gSettingsContext.bridgeDungeonCount, gSettingsContext.bridgeTokenCount);
+}
+
+u8 SplitTimer_GetLACSGoal(SplitTimerGoal* goal) {
+    if (gSettingsContext.ganonsBossKey < GANONSBOSSKEY_LACS_VANILLA) {
+        return 0;
+    }
+    // The LACS conditions are in the same order as the bridge ones, there's just no open option
+    return SplitTimer_GetGoal(goal, gSettingsContext.lacsCondition + RAINBOWBRIDGE_VANILLA, gSettingsContext.lacsStoneCount,
+                              gSettingsContext.lacsMedallionCount, gSettingsContext.lacsRewardCount,
+                              gSettingsContext.lacsDungeonCount, gSettingsContext.lacsTokenCount);
+}
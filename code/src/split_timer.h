@@ -0,0 +1,34 @@
+#ifndef _SPLIT_TIMER_H_
+#define _SPLIT_TIMER_H_
+
+#include "z3D/z3D.h"
+#include "dungeon_rewards.h"
+
+#define SPLIT_DUNGEON_COUNT (DUNGEON_GERUDO_TRAINING_GROUNDS + 1)
+
+// Events the split timer records the play time of, the first time they happen
+typedef enum {
+    SPLIT_DUNGEON_ENTERED,                                   // One per DungeonId
+    SPLIT_REWARD = SPLIT_DUNGEON_ENTERED + SPLIT_DUNGEON_COUNT, // One per DungeonReward
+    SPLIT_BOSS_KEY = SPLIT_REWARD + LIGHT_MEDALLION + 1,     // One per DungeonId
+    SPLIT_GANON_DEFEATED = SPLIT_BOSS_KEY + SPLIT_DUNGEON_COUNT,
+    SPLIT_COUNT,
+} SplitTimerEvent;
+
+// Progress towards one of the conditions for reaching Ganon
+typedef struct {
+    u8 have;
+    u8 need;
+    const char* unit;
+} SplitTimerGoal;
+
+void SplitTimer_Record(SplitTimerEvent event);
+/// Returns the play time in seconds the event happened at, or 0 if it hasn't happened yet
+u32  SplitTimer_GetTime(SplitTimerEvent event);
+void SplitTimer_Update(void);
+/// Fill in the goal and return 1 if the rainbow bridge needs anything collected
+u8   SplitTimer_GetBridgeGoal(SplitTimerGoal* goal);
+/// Fill in the goal and return 1 if Ganon's Boss Key is given by the Light Arrow Cutscene
+u8   SplitTimer_GetLACSGoal(SplitTimerGoal* goal);
+
+#endif //_SPLIT_TIMER_H_
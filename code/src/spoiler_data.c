@@ -129,7 +129,9 @@ u8 SpoilerData_MasterSwordCheck()
     return (gExtSaveData.extInf[EXTINF_MASTERSWORDFLAGS] & 2) != 0;
 }
 
-u8 SpoilerData_GetIsItemLocationCollected(u16 itemIndex)
+// Decodes the save flags a check sets when it's collected. This is slow, use SpoilerData_GetIsItemLocationCollected
+// to ask whether a check was collected.
+static u8 SpoilerData_CheckSaveFlags(u16 itemIndex)
 {
     if (itemIndex >= gSpoilerData.ItemLocationsCount) {
         return 0;
@@ -195,6 +197,76 @@ u8 SpoilerData_GetIsItemLocationCollected(u16 itemIndex)
     return 0;
 }
 
+u8 SpoilerData_GetIsItemLocationCollected(u16 itemIndex)
+{
+    if (itemIndex >= gSpoilerData.ItemLocationsCount) {
+        return 0;
+    }
+    return (gExtSaveData.collectedChecks[itemIndex / 32] >> (itemIndex % 32)) & 1;
+}
+
+static void SpoilerData_SetItemLocationCollected(u16 itemIndex)
+{
+    if (itemIndex < gSpoilerData.ItemLocationsCount) {
+        gExtSaveData.collectedChecks[itemIndex / 32] |= 1 << (itemIndex % 32);
+    }
+}
+
+void SpoilerData_SetOverrideCollected(ItemOverride_Key key)
+{
+    s32 overrideIndex = ItemOverride_GetIndex(key);
+    if (overrideIndex < 0) {
+        return;
+    }
+    u16 itemIndex = gSpoilerData.OverrideItemLocations[overrideIndex];
+    // Repeatable checks, like shop refills, only count as collected when the game says so
+    if (itemIndex != SPOILER_NO_ITEM_LOCATION && gSpoilerData.ItemLocations[itemIndex].CollectType == COLLECTTYPE_NORMAL) {
+        SpoilerData_SetItemLocationCollected(itemIndex);
+    }
+}
+
+static void SpoilerData_RefreshCollected(const u16* itemLocations, u16 itemCount)
+{
+    for (u16 i = 0; i < itemCount; i++) {
+        u16 itemIndex = itemLocations != NULL ? itemLocations[i] : i;
+        if (SpoilerData_CheckSaveFlags(itemIndex)) {
+            SpoilerData_SetItemLocationCollected(itemIndex);
+        }
+    }
+}
+
+void SpoilerData_RefreshSceneCollected(u8 sceneNum)
+{
+    if (sceneNum < SPOILER_SCENES_MAX) {
+        SpoilerData_RefreshCollected(&gSpoilerData.SceneItemLocations[gSpoilerData.SceneOffsets[sceneNum]],
+                                     gSpoilerData.SceneItemCounts[sceneNum]);
+    }
+}
+
+void SpoilerData_OnSceneEntered(void)
+{
+    static s16 previousScene = -1;
+    s16 sceneNum = gGlobalContext->sceneNum;
+
+    // Saves from before the collected checks were kept, and new saves, get them from the save flags once
+    if (!gExtSaveData.extInf[EXTINF_COLLECTEDCHECKS]) {
+        SpoilerData_RefreshCollected(NULL, gSpoilerData.ItemLocationsCount);
+        gExtSaveData.extInf[EXTINF_COLLECTEDCHECKS] = 1;
+        previousScene = sceneNum;
+        return;
+    }
+
+    // Some checks are only recorded in the save flags, like repeatable ones or flags set by shared progress.
+    // Those can only change in the scene they belong to, so only the scene that was left and the new one are checked.
+    if (previousScene >= 0) {
+        SpoilerData_RefreshSceneCollected(previousScene);
+    }
+    if (sceneNum >= 0 && sceneNum != previousScene) {
+        SpoilerData_RefreshSceneCollected(sceneNum);
+    }
+    previousScene = sceneNum;
+}
+
 u8 SpoilerData_GetIsItemLocationRevealed(u16 itemIndex) {
     if (gSettingsContext.ingameSpoilers) {
         return 1;
@@ -2,10 +2,18 @@
 #define _SPOILER_DATA_H_
 
 #include "../include/z3D/z3D.h"
+#include "item_override.h"
 
 #define SPOILER_SPHERES_MAX                 50
 #define SPOILER_ITEMS_MAX                   512
-#define SPOILER_STRING_DATA_SIZE            16384
+#define SPOILER_STRING_DATA_SIZE            24576
+#define SPOILER_HINT_REGIONS_MAX            128
+#define SPOILER_SCENES_MAX                  101
+#define SPOILER_HINTS_MAX                   64
+#define SPOILER_ROUTE_NODES_MAX             256
+#define SPOILER_ROUTE_EDGES_MAX             640
+#define SPOILER_COLLECTED_WORDS             ((SPOILER_ITEMS_MAX + 31) / 32)
+#define SPOILER_NO_ITEM_LOCATION            0xFFFF
 
 typedef enum {
     SPOILER_CHK_NONE,
@@ -70,6 +78,14 @@ typedef enum {
     REVEALTYPE_ALWAYS,
 } SpoilerItemRevealType;
 
+// Item categories the tracker can be filtered by
+typedef enum {
+    SPOILER_ITEM_CATEGORY_MAJOR,
+    SPOILER_ITEM_CATEGORY_SONG,
+    SPOILER_ITEM_CATEGORY_KEY,
+    SPOILER_ITEM_CATEGORY_COUNT,
+} SpoilerItemCategory;
+
 typedef struct {
     u16 LocationStrOffset;
     u16 ItemStrOffset;
@@ -86,6 +102,24 @@ typedef struct {
     u16 ItemLocationsOffset;
 } SpoilerSphere;
 
+typedef struct {
+    u16 StoneStrOffset;
+    u16 MessageId;
+} SpoilerHint;
+
+typedef struct {
+    s16 DiscoverIndex; // Entrance that has to be discovered to know about this connection, -1 if it isn't shuffled
+    s16 ArrivalIndex;  // Entrance the game loads when going through, used to find out where the player is
+    u16 TargetNode;
+} SpoilerRouteEdge;
+
+// Lists in the spoiler data that didn't fit and were cut short or left out
+typedef enum {
+    SPOILER_TRUNCATED_ROUTES = 1 << 0,
+    SPOILER_TRUNCATED_HINT_REGIONS = 1 << 1,
+    SPOILER_TRUNCATED_HINTS = 1 << 2,
+} SpoilerTruncatedSection;
+
 typedef struct {
     u8 SphereCount;
     u16 ItemLocationsCount;
@@ -95,6 +129,31 @@ typedef struct {
     char StringData[SPOILER_STRING_DATA_SIZE];
     u16 GroupItemCounts[SPOILER_COLLECTION_GROUP_COUNT];
     u16 GroupOffsets[SPOILER_COLLECTION_GROUP_COUNT];
+    // Item location indices sorted by hint region, item category and scene. The tracker filters
+    // use these by starting/ending at certain indices, so they never have to go through every location
+    u16 HintRegionCount;
+    u16 HintRegionNameOffsets[SPOILER_HINT_REGIONS_MAX];
+    u16 HintRegionItemCounts[SPOILER_HINT_REGIONS_MAX];
+    u16 HintRegionOffsets[SPOILER_HINT_REGIONS_MAX];
+    u16 HintRegionItemLocations[SPOILER_ITEMS_MAX];
+    u16 CategoryItemCounts[SPOILER_ITEM_CATEGORY_COUNT];
+    u16 CategoryOffsets[SPOILER_ITEM_CATEGORY_COUNT];
+    u16 CategoryItemLocations[SPOILER_ITEMS_MAX];
+    u16 SceneItemCounts[SPOILER_SCENES_MAX];
+    u16 SceneOffsets[SPOILER_SCENES_MAX];
+    u16 SceneItemLocations[SPOILER_ITEMS_MAX];
+    // Gossip stones with a hint, for the hint log. The text itself is in the custom messages
+    u16 HintCount;
+    SpoilerHint Hints[SPOILER_HINTS_MAX];
+    // Places the entrance route finder can go between, sorted by name, and the loading zones between them.
+    // The edges leaving a node start at its offset and end at the next node's offset
+    u16 RouteNodeCount;
+    u16 RouteNodeNameOffsets[SPOILER_ROUTE_NODES_MAX];
+    u16 RouteNodeEdgeOffsets[SPOILER_ROUTE_NODES_MAX + 1];
+    SpoilerRouteEdge RouteEdges[SPOILER_ROUTE_EDGES_MAX];
+    // Item location index of each entry in the item override table, SPOILER_NO_ITEM_LOCATION if it isn't tracked
+    u16 OverrideItemLocations[ITEM_OVERRIDES_MAX];
+    u8 TruncatedSections; // SpoilerTruncatedSection flags
 } SpoilerData;
 
 extern SpoilerData gSpoilerData;
@@ -102,7 +161,14 @@ extern SpoilerData gSpoilerData;
 char *SpoilerData_GetItemLocationString(u16 itemIndex);
 char *SpoilerData_GetItemNameString(u16 itemIndex);
 SpoilerItemLocation GetSpoilerItemLocation(u8 sphere, u16 itemIndex);
+/// Reads the collected checks kept in the ext save data
 u8 SpoilerData_GetIsItemLocationCollected(u16 itemIndex);
+/// Marks the check an item was given from as collected, called from every place that gives an item from an override
+void SpoilerData_SetOverrideCollected(ItemOverride_Key key);
+/// Picks up collected checks the game only records in the save flags
+void SpoilerData_OnSceneEntered(void);
+/// Same for the checks of one scene, for flags that were changed from outside of it
+void SpoilerData_RefreshSceneCollected(u8 sceneNum);
 u8 SpoilerData_ChestCheck(SpoilerItemLocation itemLoc);
 u8 SpoilerData_CollectableCheck(SpoilerItemLocation itemLoc);
 u8 SpoilerData_ItemGetInfCheck(u8 slot);
@@ -571,6 +571,19 @@ constexpr std::array DungeonColors = {
                 UNSKIPPABLE()+ITEM_OBTAINED(ITEM_KEY_SMALL)+INSTANT_TEXT_ON()+"Hai ottenuto tutte e 6 le "+COLOR(QM_RED)+"piccole"+NEWLINE()+"chiavi della sala della fortuna"+COLOR(QM_WHITE)+"!"+INSTANT_TEXT_OFF()+MESSAGE_END(),
                 UNSKIPPABLE()+"Deutsch"+MESSAGE_END());
         }
+
+        //Multiworld items found for another player, one message per player
+        if (Settings::MW_Players.Value<u8>() > 0) {
+            for (u32 player = 1; player <= Settings::MW_Players.Value<u8>() + 1u; player++) {
+                std::string number = std::to_string(player);
+                CreateMessage(0x930A + player - 1, 0, 2, 3,
+                    UNSKIPPABLE()+INSTANT_TEXT_ON()+"You found an item for "+COLOR(QM_RED)+"Player "+number+COLOR(QM_WHITE)+"!"+NEWLINE()+"It will be sent to them."+INSTANT_TEXT_OFF()+MESSAGE_END(),
+                    UNSKIPPABLE()+INSTANT_TEXT_ON()+"Vous trouvez un objet pour le "+COLOR(QM_RED)+"joueur "+number+COLOR(QM_WHITE)+"!"+NEWLINE()+"Il lui sera envoyé."+INSTANT_TEXT_OFF()+MESSAGE_END(),
+                    UNSKIPPABLE()+INSTANT_TEXT_ON()+"¡Has encontrado un objeto para el"+NEWLINE()+COLOR(QM_RED)+"jugador "+number+COLOR(QM_WHITE)+"! Se le enviará."+INSTANT_TEXT_OFF()+MESSAGE_END(),
+                    UNSKIPPABLE()+INSTANT_TEXT_ON()+"Hai trovato un oggetto per il "+COLOR(QM_RED)+"giocatore "+number+COLOR(QM_WHITE)+"!"+NEWLINE()+"Gli verrà inviato."+INSTANT_TEXT_OFF()+MESSAGE_END(),
+                    UNSKIPPABLE()+"Deutsch"+MESSAGE_END());
+            }
+        }
     }
 
     Text AddColorsAndFormat(Text text, const std::vector<u8>& colors /*= {}*/) {
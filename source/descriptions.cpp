@@ -744,6 +744,22 @@ string_view nightGSDesc               = "GS Tokens that can only be obtained dur
                                         "night expect you to have Sun's Song to collect\n" //
                                         "them. This prevents needing to wait until night\n"//
                                         "for some locations.";                             //
+/*------------------------------                                                           //
+|      PROGRESSION DEPTH       |                                                           //
+------------------------------*/                                                           //
+string_view progressionDepthNeutral   = "Required items can be anywhere they're reachable.";
+string_view progressionDepthLater     = "Required items are more likely to be placed in\n"  //
+                                        "locations that are further into the seed.";       //
+string_view progressionDepthMuchLater = "Required items are much more likely to be placed\n"//
+                                        "in locations that are further into the seed.";    //
+/*------------------------------                                                           //
+|      PROGRESSION SPREAD      |                                                           //
+------------------------------*/                                                           //
+string_view progressionSpreadOff      = "Required items can all end up in the same region.";
+string_view progressionSpreadOn       = "Every required item in a region makes it half as\n"//
+                                        "likely to get another one.";                      //
+string_view progressionSpreadStrong   = "Every required item in a region makes it a\n"     //
+                                        "quarter as likely to get another one.";           //
                                                                                            //
 /*------------------------------                                                           //
 |       CHEST ANIMATIONS       |                                                           //
@@ -762,6 +778,12 @@ string_view chestSizeDesc             = "This option will change the appearance
                                         "Small Keys     =    Small Fancy Chests";          //
                                                                                            //
 /*------------------------------                                                           //
+|       JSON SPOILER LOG       |                                                           //
+------------------------------*/                                                           //
+string_view jsonSpoilerLogDesc        = "Also writes the spoiler log as JSON, for\n"       //
+                                        "trackers and other tools to read.";               //
+                                                                                           //
+/*------------------------------                                                           //
 |        INGAME SPOILERS       |                                                           //
 ------------------------------*/                                                           //
 string_view ingameSpoilersShowDesc    = "Every spoiler is shown.";                         //
@@ -823,6 +845,14 @@ string_view iceTrapsMayhem            = "All added junk items will be Ice Traps.
 string_view iceTrapsOnslaught         = "All junk items will be replaced by Ice Traps, even"
                                         "those in the base pool.";                         //
 /*------------------------------                                                           //
+|     ICE TRAP DISGUISES       |                                                           //
+------------------------------*/                                                           //
+string_view iceTrapDisguisesMajor     = "Ice Traps look like a random major item.";        //
+string_view iceTrapDisguisesPool      = "Ice Traps look like items that are actually in\n"  //
+                                        "the world, so common items are common disguises.";//
+string_view iceTrapDisguisesNearby    = "Like Item Pool, but items placed in the same\n"    //
+                                        "region as the trap are more likely disguises.";   //
+/*------------------------------                                                           //
 |    REMOVE DOUBLE DEFENSE     |                                                           //
 ------------------------------*/                                                           //
 string_view removeDDDesc              = "If set the double defense item will be removed\n" //
@@ -983,6 +1013,23 @@ string_view mp_SharedRupeesDesc       = "Syncs rupees when shared progress is on
                                         "otherwise just shares the gain and loss.";        //
 string_view mp_SharedAmmoDesc         = "Syncs ammo when shared progress is on,\n"         //
                                         "otherwise just shares the gain and loss.";        //
+string_view mp_SpectatorDesc          = "Joins the network without playing. The bottom\n"  //
+                                        "screen shows a live tracker of every player on\n" //
+                                        "the same seed hash, and nothing but keepalives\n" //
+                                        "is sent to them.\n"                               //
+                                        "\n"                                               //
+                                        "Does not affect seed generation.";                //
+string_view mw_PlayersDesc            = "Every player gets their own world, shuffled\n"    //
+                                        "separately, and items can belong to any of\n"     //
+                                        "them. Items found for someone else are sent to\n" //
+                                        "them over the network.\n"                         //
+                                        "\n"                                               //
+                                        "Everyone needs to generate with the same seed\n"  //
+                                        "and settings. Shared progress is unavailable.";   //
+string_view mw_PlayerIdDesc           = "Which player of the multiworld this console\n"    //
+                                        "is. Every player needs a different ID.\n"         //
+                                        "\n"                                               //
+                                        "Does not affect the seed hash.";                  //
                                                                                            //
 /*------------------------------                                                           //
 |       INGAME DEFAULTS        |                                                           //
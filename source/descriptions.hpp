@@ -243,11 +243,19 @@ extern string_view startingTimeDesc;
 
 extern string_view locationsReachableDesc;
 extern string_view nightGSDesc;
+extern string_view progressionDepthNeutral;
+extern string_view progressionDepthLater;
+extern string_view progressionDepthMuchLater;
+extern string_view progressionSpreadOff;
+extern string_view progressionSpreadOn;
+extern string_view progressionSpreadStrong;
 
 extern string_view chestAnimDesc;
 
 extern string_view chestSizeDesc;
 
+extern string_view jsonSpoilerLogDesc;
+
 extern string_view ingameSpoilersShowDesc;
 extern string_view ingameSpoilersHideDesc;
 
@@ -272,6 +280,10 @@ extern string_view iceTrapsExtra;
 extern string_view iceTrapsMayhem;
 extern string_view iceTrapsOnslaught;
 
+extern string_view iceTrapDisguisesMajor;
+extern string_view iceTrapDisguisesPool;
+extern string_view iceTrapDisguisesNearby;
+
 extern string_view removeDDDesc;
 
 extern string_view progGoronSword;
@@ -309,6 +321,9 @@ extern string_view mp_SyncIdDesc;
 extern string_view mp_SharedHealthDesc;
 extern string_view mp_SharedRupeesDesc;
 extern string_view mp_SharedAmmoDesc;
+extern string_view mp_SpectatorDesc;
+extern string_view mw_PlayersDesc;
+extern string_view mw_PlayerIdDesc;
 
 extern string_view silenceNaviDesc;
 extern string_view ignoreMaskReactionDesc;
@@ -377,6 +377,8 @@ static bool ReplaceEntrance(Entrance* entrance, Entrance* target, std::vector<En
       //PlacementLog_Msg(message);
       //Areas::DumpWorldGraph(ticks);
     #endif
+    //Item fill only ever searches this world with fewer items, so keep what was reachable
+    Areas::SaveValidatedAccess();
     rollbacks.push_back(EntrancePair{entrance, target});
     curNumRandomizedEntrances++;
     DisplayEntranceProgress();
@@ -459,6 +461,8 @@ static void ShuffleEntrancePool(std::vector<Entrance*>& entrancePool, std::vecto
           RestoreConnections(pair.first, pair.second);
           curNumRandomizedEntrances--;
         }
+        //The access was validated on connections that were just undone
+        Areas::ClearValidatedAccess();
         continue;
       }
     } else {
@@ -466,6 +470,7 @@ static void ShuffleEntrancePool(std::vector<Entrance*>& entrancePool, std::vecto
         RestoreConnections(pair.first, pair.second);
         curNumRandomizedEntrances--;
       }
+      Areas::ClearValidatedAccess();
       continue;
     }
 
@@ -487,6 +492,8 @@ int ShuffleAllEntrances() {
 
   totalRandomizableEntrances = 0;
   curNumRandomizedEntrances = 0;
+  //Nothing validated by an earlier attempt applies to this one
+  Areas::ClearValidatedAccess();
 
   std::vector<EntranceInfoPair> entranceShuffleTable = {
                                    //Parent Region                     Connected Region                  index   blue warp
@@ -832,6 +839,9 @@ int ShuffleAllEntrances() {
     }
   }
 
+  //the last validation that passed was done on the final connections, let the fill start from it
+  Areas::ApplyValidatedAccess();
+
   return ENTRANCE_SHUFFLE_SUCCESS;
 }
 
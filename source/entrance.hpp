@@ -75,10 +75,10 @@ public:
     void printAgeTimeAccess() {
       CitraPrint("Name: ");
       CitraPrint(name);
-      auto message = "Child Day:   " + std::to_string(CheckConditionAtAgeTime(Logic::IsChild, Logic::AtDay))   + "\t"
-                     "Child Night: " + std::to_string(CheckConditionAtAgeTime(Logic::IsChild, Logic::AtNight)) + "\t"
-                     "Adult Day:   " + std::to_string(CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtDay))   + "\t"
-                     "Adult Night: " + std::to_string(CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtNight));
+      auto message = "Child Day:   " + std::to_string(CheckConditionAtAgeTime(AGETIME_CHILD_DAY))   + "\t"
+                     "Child Night: " + std::to_string(CheckConditionAtAgeTime(AGETIME_CHILD_NIGHT)) + "\t"
+                     "Adult Day:   " + std::to_string(CheckConditionAtAgeTime(AGETIME_ADULT_DAY))   + "\t"
+                     "Adult Night: " + std::to_string(CheckConditionAtAgeTime(AGETIME_ADULT_NIGHT));
       CitraPrint(message);
     }
 
@@ -92,30 +92,25 @@ public:
         }
 
         //check all possible day/night condition combinations
-        conditionsMet = (parent->childDay   && CheckConditionAtAgeTime(Logic::IsChild, Logic::AtDay, allAgeTimes))   +
-                        (parent->childNight && CheckConditionAtAgeTime(Logic::IsChild, Logic::AtNight, allAgeTimes)) +
-                        (parent->adultDay   && CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtDay, allAgeTimes))   +
-                        (parent->adultNight && CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtNight, allAgeTimes));
+        for (u8 ageTime = AGETIME_CHILD_DAY; ageTime <= AGETIME_ADULT_NIGHT; ageTime <<= 1) {
+            conditionsMet += (parent->ageTimeAccess & ageTime) && CheckConditionAtAgeTime(ageTime, allAgeTimes);
+        }
 
         return conditionsMet && (!allAgeTimes || conditionsMet == 4);
     }
 
+    //Returns which of the given ages and times of day the exit can be taken at
+    u8 SearchAgeTimes(u8 ageTimes, bool stopAtFirstPass = true) const {
+        return CheckAgeTimes(ageTimes, stopAtFirstPass, [this](u8 ageTime){return CheckConditionAtAgeTime(ageTime);});
+    }
+
     AreaKey GetAreaKey() const {
         return connectedRegion;
     }
 
     //set the logic to be a specific age and time of day and see if the condition still holds
-    bool CheckConditionAtAgeTime(bool& age, bool& time, bool passAnyway = false) const {
-
-        Logic::IsChild = false;
-        Logic::IsAdult = false;
-        Logic::AtDay   = false;
-        Logic::AtNight = false;
-
-        time = true;
-        age = true;
-
-        Logic::UpdateHelpers();
+    bool CheckConditionAtAgeTime(u8 ageTime, bool passAnyway = false) const {
+        Areas::SetLogicAgeTime(ageTime);
         return GetConditionsMet() && (connectedRegion != NONE || passAnyway);
     }
 
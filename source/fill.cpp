@@ -6,9 +6,11 @@
 #include "item_pool.hpp"
 #include "location_access.hpp"
 #include "logic.hpp"
+#include "multiworld.hpp"
 #include "random.hpp"
 #include "spoiler_log.hpp"
 #include "starting_inventory.hpp"
+#include "woth_requirements.hpp"
 #include "hints.hpp"
 #include "hint_list.hpp"
 #include "entrance.hpp"
@@ -18,6 +20,8 @@
 #include <vector>
 #include <unistd.h>
 #include <list>
+#include <map>
+#include <algorithm>
 
 using namespace CustomMessages;
 using namespace Logic;
@@ -25,6 +29,27 @@ using namespace Settings;
 
 static bool placementFailure = false;
 
+//Set while a multiworld search runs. The world being searched doesn't collect the items it finds for other
+//players, or any of the items it finds with deferFoundItems set. They're left in foundItemLocations for
+//the multiworld search to hand out instead.
+static bool searchingMultiworld = false;
+static bool deferFoundItems = false;
+static std::vector<LocationKey> foundItemLocations;
+
+//Where a multiworld search of one world stopped. Once the world receives more items, the search goes on from
+//there instead of starting over, since everything it reached before can still be reached.
+struct WorldSearch {
+  bool started = false;
+  bool beaten = false;
+  std::vector<ItemKey> items;               //Everything the world has besides its starting inventory
+  std::vector<AreaKey> areaPool;
+  std::vector<u8> ageTimeAccess;            //Indexed by area key
+  std::vector<bool> areasAdded;             //Indexed by area key
+  std::vector<bool> locationsAdded;         //Indexed by location key
+  std::vector<EventAccess*> events;         //The events that have happened
+  std::vector<LocationKey> accessibleLocations;
+};
+
 static void RemoveStartingItemsFromPool() {
   for (ItemKey startingItem : StartingInventory) {
     for (size_t i = 0; i < ItemPool.size(); i++) {
@@ -46,40 +71,43 @@ static void RemoveStartingItemsFromPool() {
   }
 }
 
-//This function will propogate Time of Day access through the entrance
-static bool UpdateToDAccess(Entrance* entrance, SearchMode mode) {
+//This function will propogate Time of Day access through the entrance. The ages and times of day
+//the exit was checked at are returned in passedAgeTimes and failedAgeTimes, so the search doesn't
+//have to check them again when it looks at whether the exit adds its area to the pool.
+static bool UpdateToDAccess(Entrance* entrance, SearchMode mode, u8& passedAgeTimes, u8& failedAgeTimes) {
 
   bool ageTimePropogated = false;
+  bool rootAccessChanged = false;
 
   //propogate childDay, childNight, adultDay, and adultNight separately
   Area* parent = entrance->GetParentRegion();
   Area* connection = entrance->GetConnectedRegion();
 
-  if (!connection->childDay && parent->childDay && entrance->CheckConditionAtAgeTime(IsChild, AtDay)) {
-    connection->childDay = true;
-    ageTimePropogated = true;
-  }
-  if (!connection->childNight && parent->childNight && entrance->CheckConditionAtAgeTime(IsChild, AtNight)) {
-    connection->childNight = true;
-    ageTimePropogated = true;
-  }
-  if (!connection->adultDay && parent->adultDay && entrance->CheckConditionAtAgeTime(IsAdult, AtDay)) {
-    connection->adultDay = true;
-    ageTimePropogated = true;
-  }
-  if (!connection->adultNight && parent->adultNight && entrance->CheckConditionAtAgeTime(IsAdult, AtNight)) {
-    connection->adultNight = true;
-    ageTimePropogated = true;
+  for (u8 ageTime = AGETIME_CHILD_DAY; ageTime <= AGETIME_ADULT_NIGHT; ageTime <<= 1) {
+    if (!(connection->ageTimeAccess & ageTime) && (parent->ageTimeAccess & ageTime) && (connection->maxAgeTimeAccess & ageTime)) {
+      if (entrance->CheckConditionAtAgeTime(ageTime)) {
+        passedAgeTimes |= ageTime;
+        connection->AddAgeTimes(ageTime);
+        ageTimePropogated = true;
+      } else {
+        failedAgeTimes |= ageTime;
+      }
+    }
   }
 
-  //special check for temple of time
+  //special check for temple of time, child day/night access shifted up is adult day/night access
   bool propogateTimeTravel = mode != SearchMode::TimePassAccess && mode != SearchMode::TempleOfTimeAccess;
-  if (!AreaTable(ROOT)->Adult() && AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Child() && propogateTimeTravel) {
-    AreaTable(ROOT)->adultDay   = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->childDay;
-    AreaTable(ROOT)->adultNight = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->childNight;
-  } else if (!AreaTable(ROOT)->Child() && AreaTable(TOT_BEYOND_DOOR_OF_TIME)->Adult() && propogateTimeTravel){
-    AreaTable(ROOT)->childDay   = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->adultDay;
-    AreaTable(ROOT)->childNight = AreaTable(TOT_BEYOND_DOOR_OF_TIME)->adultNight;
+  Area* root = AreaTable(ROOT);
+  Area* beyondDoorOfTime = AreaTable(TOT_BEYOND_DOOR_OF_TIME);
+  if (!root->Adult() && beyondDoorOfTime->Child() && propogateTimeTravel) {
+    rootAccessChanged = root->AddAgeTimes((beyondDoorOfTime->ageTimeAccess & AGETIME_CHILD) << 2);
+  } else if (!root->Child() && beyondDoorOfTime->Adult() && propogateTimeTravel){
+    rootAccessChanged = root->AddAgeTimes((beyondDoorOfTime->ageTimeAccess & AGETIME_ADULT) >> 2);
+  }
+
+  //Conditions can read the access of other areas, so a check that failed before access changed could pass now
+  if (ageTimePropogated || rootAccessChanged) {
+    failedAgeTimes = 0;
   }
 
   return ageTimePropogated;
@@ -115,16 +143,9 @@ static void ValidateWorldChecks(SearchMode& mode, bool checkPoeCollectorAccess,
       ItemTable(unplacedItem).ApplyEffect();
     }
     // Reset access as the non-starting age
-    if (Settings::ResolvedStartingAge == AGE_CHILD) {
-      for (AreaKey areaKey : areaPool) {
-        AreaTable(areaKey)->adultDay = false;
-        AreaTable(areaKey)->adultNight = false;
-      }
-    } else {
-      for (AreaKey areaKey : areaPool) {
-        AreaTable(areaKey)->childDay = false;
-        AreaTable(areaKey)->childNight = false;
-      }
+    const u8 nonStartingAge = Settings::ResolvedStartingAge == AGE_CHILD ? AGETIME_ADULT : AGETIME_CHILD;
+    for (AreaKey areaKey : areaPool) {
+      AreaTable(areaKey)->RemoveAgeTimes(nonStartingAge);
     }
     mode = SearchMode::AllLocationsReachable;
   } else {
@@ -187,33 +208,167 @@ std::vector<LocationKey> GetAllEmptyLocations() {
   return FilterFromPool(allLocations, [](const LocationKey loc){ return Location(loc)->GetPlacedItemKey() == NONE;});
 }
 
+//Decides whether an advancement item found while generating the playthrough is left out of it
+//This preprocessing is done to reduce the amount of searches performed in PareDownPlaythrough
+//Want to exclude:
+//1) Tokens after the last potentially useful one (the last one that gives an advancement item or last for token bridge)
+//2) Bombchus after the first (including buy bombchus)
+//3) Buy items of the same type, after the first (So only see Buy Deku Nut of any amount once)
+struct PlaythroughFilter {
+  int gsCount = 0;
+  int maxGsCount = 0;
+  bool bombchusFound = false;
+  std::vector<std::string> buyIgnores;
+
+  bool Exclude(const ItemLocation* location) {
+    ItemType type = location->GetPlacedItem().GetItemType();
+    std::string itemName(location->GetPlacedItemName().GetNAEnglish());
+    bool bombchus = itemName.find("Bombchu") != std::string::npos; //Is a bombchu location
+
+    //Exclude tokens after the last possibly useful one
+    if (type == ITEMTYPE_TOKEN && gsCount < maxGsCount) {
+      gsCount++;
+      return false;
+    }
+    //Only print first bombchu location found
+    else if (bombchus && !bombchusFound) {
+      bombchusFound = true;
+      return false;
+    }
+    //Handle buy items
+    //If ammo drops are off, don't do this step, since buyable ammo becomes logically important
+    else if (AmmoDrops.IsNot(AMMODROPS_NONE) && !(bombchus && bombchusFound) && type == ITEMTYPE_SHOP) {
+      //Only check each buy item once
+      std::string buyItem = GetShopItemBaseName(itemName);
+      //Buy item not in list to ignore, add it to list and write to playthrough
+      if (std::find(buyIgnores.begin(), buyIgnores.end(), buyItem) == buyIgnores.end()) {
+        buyIgnores.push_back(buyItem);
+        return false;
+      }
+    }
+    //Add all other advancement items
+    else if (!bombchus && type != ITEMTYPE_TOKEN && (AmmoDrops.Is(AMMODROPS_NONE) || type != ITEMTYPE_SHOP)) {
+      return false;
+    }
+    return true;
+  }
+};
+
+static void SaveWorldSearch(WorldSearch& worldSearch, const std::vector<AreaKey>& areaPool, const std::vector<LocationKey>& accessibleLocations) {
+  worldSearch.started = true;
+  worldSearch.beaten = playthroughBeatable;
+  worldSearch.areaPool = areaPool;
+  worldSearch.accessibleLocations = accessibleLocations;
+
+  worldSearch.ageTimeAccess.resize(areaTable.size());
+  worldSearch.areasAdded.resize(areaTable.size());
+  for (size_t i = 0; i < areaTable.size(); i++) {
+    worldSearch.ageTimeAccess[i] = areaTable[i].ageTimeAccess;
+    worldSearch.areasAdded[i] = areaTable[i].addedToPool;
+  }
+
+  worldSearch.locationsAdded.assign(KEY_ENUM_MAX, false);
+  for (LocationKey loc : Multiworld::GetWorldLocations()) {
+    worldSearch.locationsAdded[loc] = Location(loc)->IsAddedToPool();
+  }
+
+  worldSearch.events.clear();
+  for (AreaKey areaKey : areaPool) {
+    for (EventAccess& event : AreaTable(areaKey)->events) {
+      if (event.GetEvent()) {
+        worldSearch.events.push_back(&event);
+      }
+    }
+  }
+}
+
+static void RestoreWorldSearch(const WorldSearch& worldSearch) {
+  for (size_t i = 0; i < areaTable.size(); i++) {
+    areaTable[i].ageTimeAccess = worldSearch.ageTimeAccess[i];
+    areaTable[i].addedToPool = worldSearch.areasAdded[i];
+  }
+  LocationReset();
+  for (LocationKey loc : Multiworld::GetWorldLocations()) {
+    if (worldSearch.locationsAdded[loc]) {
+      Location(loc)->AddToPool();
+    }
+  }
+  for (EventAccess* event : worldSearch.events) {
+    event->EventOccurred();
+  }
+  if (worldSearch.beaten) {
+    playthroughBeatable = true;
+  }
+}
+
+//Adds a shuffled exit to the entrance playthrough the first time its area is reached
+static void AddToEntranceSphere(Entrance& exit, std::list<Entrance*>& entranceSphere) {
+  if (exit.IsShuffled() && !exit.IsAddedToPool() && !noRandomEntrances) {
+    entranceSphere.push_back(&exit);
+    exit.AddToPool();
+    // Don't list a coupled entrance from both directions
+    if (exit.GetReplacement()->GetReverse() != nullptr /*&& !DecoupleEntrances*/) {
+      exit.GetReplacement()->GetReverse()->AddToPool();
+    }
+  }
+}
+
 //This function will return a vector of ItemLocations that are accessible with
 //where items have been placed so far within the world. The allowedLocations argument
-//specifies the pool of locations that we're trying to search for an accessible location in
-std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>& allowedLocations, SearchMode mode /* = SearchMode::ReachabilitySearch*/, std::string ignore /*= ""*/, bool checkPoeCollectorAccess /*= false*/, bool checkOtherEntranceAccess /*= false*/) {
+//specifies the pool of locations that we're trying to search for an accessible location in.
+//With a worldSearch, the search starts from where it left off and is saved back into it.
+static std::vector<LocationKey> SearchWorld(const std::vector<LocationKey>& allowedLocations, SearchMode mode, std::string ignore, bool checkPoeCollectorAccess, bool checkOtherEntranceAccess, WorldSearch* worldSearch) {
   std::vector<LocationKey> accessibleLocations;
+  std::vector<AreaKey> areaPool = {ROOT};
   // Reset all access to begin a new search
   if (mode < SearchMode::ValidateWorld) {
     ApplyStartingInventory();
+    if (!searchingMultiworld) {
+      Multiworld::ApplyReceivedItems();
+    }
+  }
+  if (worldSearch != nullptr) {
+    for (ItemKey item : worldSearch->items) {
+      ItemTable(item).ApplyEffect();
+    }
+  }
+  if (worldSearch != nullptr && worldSearch->started) {
+    RestoreWorldSearch(*worldSearch);
+    areaPool = worldSearch->areaPool;
+    accessibleLocations = worldSearch->accessibleLocations;
+  } else {
+    Areas::AccessReset();
+    LocationReset();
   }
-  Areas::AccessReset();
-  LocationReset();
-  std::vector<AreaKey> areaPool = {ROOT};
 
   if (mode == SearchMode::ValidateWorld) {
     mode = SearchMode::TimePassAccess;
-    AreaTable(ROOT)->childNight = true;
-    AreaTable(ROOT)->adultNight = true;
-    AreaTable(ROOT)->childDay = true;
-    AreaTable(ROOT)->adultDay = true;
+    AreaTable(ROOT)->AddAgeTimes(AGETIME_ALL);
     allLocationsReachable = false;
   }
 
   //Variables for playthrough
-  int gsCount = 0;
-  const int maxGsCount = mode == SearchMode::GeneratePlaythrough ? GetMaxGSCount() : 0; //If generating playthrough want the max that's possibly useful, else doesn't matter
-  bool bombchusFound = false;
-  std::vector<std::string> buyIgnores;
+  PlaythroughFilter playthroughFilter;
+  if (mode == SearchMode::GeneratePlaythrough) {
+    playthroughFilter.maxGsCount = GetMaxGSCount(); //If generating playthrough want the max that's possibly useful, else doesn't matter
+  }
+
+  //Variables for targeted search
+  std::vector<bool> isTarget;
+  size_t targetsRemaining = 0;
+  if (mode == SearchMode::TargetedSearch) {
+    isTarget.resize(KEY_ENUM_MAX, false);
+    for (LocationKey loc : allowedLocations) {
+      if (!isTarget[loc] && Location(loc)->GetPlacedItemKey() == NONE) {
+        isTarget[loc] = true;
+        targetsRemaining++;
+      }
+    }
+    //A multiworld search still needs the items in a world without targets
+    if (targetsRemaining == 0 && !searchingMultiworld) {
+      return {};
+    }
+  }
 
   //Variables for search
   std::vector<ItemLocation*> newItemLocations;
@@ -221,11 +376,8 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
   bool ageTimePropogated = false;
   bool firstIteration = true;
 
-  //Variables for Time Pass access
-  bool timePassChildDay = false;
-  bool timePassChildNight = false;
-  bool timePassAdultDay = false;
-  bool timePassAdultNight = false;
+  //Ages and times of day which have reached an area with Time Pass access
+  u8 timePassAgeTimes = 0;
 
   // Main access checking loop
   while (newItemLocations.size() > 0 || updatedEvents || ageTimePropogated || firstIteration) {
@@ -235,6 +387,9 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
 
     for (ItemLocation* location : newItemLocations) {
       location->ApplyPlacedItemEffect();
+      if (worldSearch != nullptr) {
+        worldSearch->items.push_back(location->GetPlacedItemKey());
+      }
     }
     newItemLocations.clear();
 
@@ -254,22 +409,11 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
       // in any area.
       if (mode == SearchMode::TimePassAccess) {
         if (area->timePass) {
-          if (area->childDay) {
-            timePassChildDay = true;
-          }
-          if (area->childNight) {
-            timePassChildNight = true;
-          }
-          if (area->adultDay) {
-            timePassAdultDay = true;
-          }
-          if (area->adultNight) {
-            timePassAdultNight = true;
-          }
+          timePassAgeTimes |= area->ageTimeAccess;
         }
         // Condition for validating that all startring AgeTimes have timepass access
         // Once satisifed, change the mode to begin checking for Temple of Time Access
-        if ((timePassChildDay && timePassChildNight && timePassAdultDay && timePassAdultNight) || !checkOtherEntranceAccess) {
+        if (timePassAgeTimes == AGETIME_ALL || !checkOtherEntranceAccess) {
           mode = SearchMode::TempleOfTimeAccess;
         }
       }
@@ -278,26 +422,26 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
       for (auto& exit : area->exits) {
 
         //Update Time of Day Access for the exit
-        if (UpdateToDAccess(&exit, mode)) {
+        u8 passedAgeTimes = 0;
+        u8 failedAgeTimes = 0;
+        if (UpdateToDAccess(&exit, mode, passedAgeTimes, failedAgeTimes)) {
           ageTimePropogated = true;
           ValidateWorldChecks(mode, checkPoeCollectorAccess, checkOtherEntranceAccess, areaPool);
+          //Items and access can also be taken away by the checks
+          passedAgeTimes = 0;
         }
 
         //If the exit is accessible and hasn't been added yet, add it to the pool
         Area* exitArea = exit.GetConnectedRegion();
-        if (!exitArea->addedToPool && exit.ConditionsMet()) {
+        const u8 exitAgeTimes = exit.GetParentRegion()->ageTimeAccess & exitArea->maxAgeTimeAccess;
+        if (!exitArea->addedToPool && ((passedAgeTimes & exitAgeTimes) || exit.SearchAgeTimes(exitAgeTimes & ~failedAgeTimes))) {
           exitArea->addedToPool = true;
           areaPool.push_back(exit.GetAreaKey());
         }
 
         // Add shuffled entrances to the entrance playthrough
-        if (mode == SearchMode::GeneratePlaythrough && exit.IsShuffled() && !exit.IsAddedToPool() && !noRandomEntrances) {
-          entranceSphere.push_back(&exit);
-          exit.AddToPool();
-          // Don't list a coupled entrance from both directions
-          if (exit.GetReplacement()->GetReverse() != nullptr /*&& !DecoupleEntrances*/) {
-            exit.GetReplacement()->GetReverse()->AddToPool();
-          }
+        if (mode == SearchMode::GeneratePlaythrough) {
+          AddToEntranceSphere(exit, entranceSphere);
         }
       }
 
@@ -308,12 +452,29 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
           LocationKey loc = locPair.GetLocation();
           ItemLocation* location = Location(loc);
 
-          if (!location->IsAddedToPool() && locPair.ConditionsMet()) {
+          //Targeted and beatability searches don't need to check locations that can't
+          //open up more of the world, unless it's one of the locations being searched for
+          if (mode == SearchMode::TargetedSearch || mode == SearchMode::CheckBeatable) {
+            ItemKey placedItem = location->GetPlacedItemKey();
+            bool searchedFor = mode == SearchMode::TargetedSearch ? isTarget[loc] : placedItem == TRIFORCE;
+            if (!searchedFor && (placedItem == NONE || !location->GetPlacedItem().IsAdvancement())) {
+              continue;
+            }
+          }
+
+          if (!location->IsAddedToPool() && locPair.SearchConditionsMet()) {
 
             location->AddToPool();
 
             if (location->GetPlacedItemKey() == NONE) {
               accessibleLocations.push_back(loc); //Empty location, consider for placement
+              //Every target has been found, nothing else in the search can change the result
+              if (mode == SearchMode::TargetedSearch && --targetsRemaining == 0 && !searchingMultiworld) {
+                return accessibleLocations;
+              }
+            } else if (deferFoundItems || Multiworld::IsForeign(loc)) {
+              //Items for other players don't help this world, a multiworld search hands them out instead
+              foundItemLocations.push_back(loc);
             } else {
               //If ignore has a value, we want to check if the item location should be considered or not
               //This is necessary due to the below preprocessing for playthrough generation
@@ -346,44 +507,8 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
             if (mode == SearchMode::GeneratePlaythrough) {
               //Item is an advancement item, figure out if it should be added to this sphere
               if (!playthroughBeatable && location->GetPlacedItem().IsAdvancement()) {
-                ItemType type = location->GetPlacedItem().GetItemType();
-                std::string itemName(location->GetPlacedItemName().GetNAEnglish());
-                bool bombchus = itemName.find("Bombchu") != std::string::npos; //Is a bombchu location
-
-                //Decide whether to exclude this location
-                //This preprocessing is done to reduce the amount of searches performed in PareDownPlaythrough
-                //Want to exclude:
-                //1) Tokens after the last potentially useful one (the last one that gives an advancement item or last for token bridge)
-                //2) Bombchus after the first (including buy bombchus)
-                //3) Buy items of the same type, after the first (So only see Buy Deku Nut of any amount once)
-                bool exclude = true;
-                //Exclude tokens after the last possibly useful one
-                if (type == ITEMTYPE_TOKEN && gsCount < maxGsCount) {
-                  gsCount++;
-                  exclude = false;
-                }
-                //Only print first bombchu location found
-                else if (bombchus && !bombchusFound) {
-                  bombchusFound = true;
-                  exclude = false;
-                }
-                //Handle buy items
-                //If ammo drops are off, don't do this step, since buyable ammo becomes logically important
-                else if (AmmoDrops.IsNot(AMMODROPS_NONE) && !(bombchus && bombchusFound) && type == ITEMTYPE_SHOP) {
-                  //Only check each buy item once
-                  std::string buyItem = GetShopItemBaseName(itemName);
-                  //Buy item not in list to ignore, add it to list and write to playthrough
-                  if (std::find(buyIgnores.begin(), buyIgnores.end(), buyItem) == buyIgnores.end()) {
-                    exclude = false;
-                    buyIgnores.push_back(buyItem);
-                  }
-                }
-                //Add all other advancement items
-                else if (!bombchus && type != ITEMTYPE_TOKEN && (AmmoDrops.Is(AMMODROPS_NONE) || type != ITEMTYPE_SHOP)) {
-                  exclude = false;
-                }
                 //Has not been excluded, add to playthrough
-                if (!exclude) {
+                if (!playthroughFilter.Exclude(location)) {
                   itemSphere.push_back(loc);
                 }
               }
@@ -397,7 +522,10 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
             //All we care about is if the game is beatable, used to pare down playthrough
             else if (location->GetPlacedItemKey() == TRIFORCE && mode == SearchMode::CheckBeatable) {
               playthroughBeatable = true;
-              return {}; //Return early for efficiency
+              //The other players might still need items from this world
+              if (!searchingMultiworld) {
+                return {}; //Return early for efficiency
+              }
             }
           }
         }
@@ -412,6 +540,10 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
     }
   }
 
+  if (worldSearch != nullptr) {
+    SaveWorldSearch(*worldSearch, areaPool, accessibleLocations);
+  }
+
   //Check to see if all locations were reached
   if (mode == SearchMode::AllLocationsReachable) {
     allLocationsReachable = true;
@@ -439,12 +571,30 @@ std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>&
   return accessibleLocations;
 }
 
+std::vector<LocationKey> GetAccessibleLocations(const std::vector<LocationKey>& allowedLocations, SearchMode mode /* = SearchMode::ReachabilitySearch*/, std::string ignore /*= ""*/, bool checkPoeCollectorAccess /*= false*/, bool checkOtherEntranceAccess /*= false*/) {
+  return SearchWorld(allowedLocations, mode, ignore, checkPoeCollectorAccess, checkOtherEntranceAccess, nullptr);
+}
+
 static void GeneratePlaythrough() {
   playthroughBeatable = false;
   LogicReset();
   GetAccessibleLocations(allLocations, SearchMode::GeneratePlaythrough);
 }
 
+//The items of the same kind the playthrough has to do without, when checking if an item can be removed from it
+static std::string GetPlaythroughIgnore(ItemKey item) {
+  if (ItemTable(item).GetItemType() == ITEMTYPE_TOKEN) {
+    return "Tokens";
+  }
+  else if (ItemTable(item).GetName().GetNAEnglish().find("Bombchu") != std::string::npos) {
+    return "Bombchus";
+  }
+  else if (ItemTable(item).GetItemType() == ITEMTYPE_SHOP) {
+    return GetShopItemBaseName(ItemTable(item).GetName().GetNAEnglish());
+  }
+  return "";
+}
+
 //Remove unnecessary items from playthrough by removing their location, and checking if game is still beatable
 //To reduce searches, some preprocessing is done in playthrough generation to avoid adding obviously unnecessary items
 static void PareDownPlaythrough() {
@@ -461,18 +611,7 @@ static void PareDownPlaythrough() {
       playthroughBeatable = false;
       LogicReset();
 
-      std::string ignore = "";
-      if (ItemTable(copy).GetItemType() == ITEMTYPE_TOKEN) {
-        ignore = "Tokens";
-      }
-      else if (ItemTable(copy).GetName().GetNAEnglish().find("Bombchu") != std::string::npos) {
-        ignore = "Bombchus";
-      }
-      else if (ItemTable(copy).GetItemType() == ITEMTYPE_SHOP) {
-        ignore = GetShopItemBaseName(ItemTable(copy).GetName().GetNAEnglish());
-      }
-
-      GetAccessibleLocations(allLocations, SearchMode::CheckBeatable, ignore); //Check if game is still beatable
+      GetAccessibleLocations(allLocations, SearchMode::CheckBeatable, GetPlaythroughIgnore(copy)); //Check if game is still beatable
 
       //Playthrough is still beatable without this item, therefore it can be removed from playthrough section.
       if (playthroughBeatable) {
@@ -532,12 +671,18 @@ static void CalculateWotH() {
     //Else, delete from wothLocations
     if (playthroughBeatable) {
       wothLocations.erase(wothLocations.begin() + i);
+    } else {
+      //The search got as far as the world goes without the item
+      WothRequirements::RecordWithout(loc);
     }
   }
 
   playthroughBeatable = true;
   LogicReset();
   GetAccessibleLocations(allLocations);
+
+  //Compare what each Way of the Hero item's search could open with everything collected
+  WothRequirements::Build();
 }
 
 //Will place things completely randomly, no logic checks are performed
@@ -561,6 +706,74 @@ static void FastFill(std::vector<ItemKey> items, std::vector<LocationKey> locati
 | This method helps distribution of items locked behind many requirements.
 | - OoT Randomizer
 */
+//Placement bias. With either setting on, advancement items pick their location with weights instead of
+//uniformly. The search finds locations roughly in the order they open up, so later ones in the list get
+//more weight for Progression Depth. For Progression Spread, every advancement item already in a hint
+//region halves (or quarters) the weight of the other locations there.
+#define PLACEMENT_WEIGHT_SCALE 16
+
+static std::map<LocationKey, HintKey> placementRegions;
+static std::map<HintKey, int> progressionPerRegion;
+
+static bool PlacementBiasEnabled() {
+  return !ProgressionDepth.Is(0) || !ProgressionSpread.Is(0);
+}
+
+static HintKey GetPlacementRegion(LocationKey loc) {
+  auto it = placementRegions.find(loc);
+  if (it == placementRegions.end()) {
+    it = placementRegions.emplace(loc, GetLocationRegionHintKey(loc)).first;
+  }
+  return it->second;
+}
+
+static void CountProgressionPerRegion() {
+  progressionPerRegion.clear();
+  if (ProgressionSpread.Is(0)) {
+    return;
+  }
+  for (LocationKey loc : allLocations) {
+    ItemKey item = Location(loc)->GetPlacedItemKey();
+    if (item != NONE && ItemTable(item).IsAdvancement()) {
+      progressionPerRegion[GetPlacementRegion(loc)]++;
+    }
+  }
+}
+
+//The weight of the location at the given index of count accessible locations, with placedInRegion
+//advancement items already in its hint region
+static u32 GetPlacementWeight(size_t index, size_t count, int placedInRegion) {
+  static constexpr std::array<u32, 3> depthBias = {0, 1, 3};
+  static constexpr std::array<int, 3> spreadShift = {0, 1, 2};
+  const u32 bias = depthBias[ProgressionDepth.Value<u8>()];
+  const int shift = spreadShift[ProgressionSpread.Value<u8>()];
+
+  u32 weight = PLACEMENT_WEIGHT_SCALE + PLACEMENT_WEIGHT_SCALE * bias * index / count;
+  if (shift != 0 && placedInRegion > 0) {
+    weight >>= std::min(placedInRegion * shift, 4);
+  }
+  return weight;
+}
+
+static LocationKey SelectPlacementLocation(ItemKey item, const std::vector<LocationKey>& accessibleLocations) {
+  if (!PlacementBiasEnabled() || !ItemTable(item).IsAdvancement()) {
+    return RandomElement(accessibleLocations);
+  }
+  const size_t count = accessibleLocations.size();
+
+  std::vector<u32> weights;
+  weights.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto placed = progressionPerRegion.find(GetPlacementRegion(accessibleLocations[i]));
+    weights.push_back(GetPlacementWeight(i, count, placed != progressionPerRegion.end() ? placed->second : 0));
+  }
+  LocationKey selected = accessibleLocations[WeightedSampler(weights).Draw()];
+  if (!ProgressionSpread.Is(0)) {
+    progressionPerRegion[GetPlacementRegion(selected)]++;
+  }
+  return selected;
+}
+
 static void AssumedFill(const std::vector<ItemKey>& items, const std::vector<LocationKey>& allowedLocations, bool setLocationsAsHintable = false) {
 
   if (items.size() > allowedLocations.size()) {
@@ -599,6 +812,9 @@ static void AssumedFill(const std::vector<ItemKey>& items, const std::vector<Loc
     }
     unsuccessfulPlacement = false;
     std::vector<ItemKey> itemsToPlace = items;
+    if (PlacementBiasEnabled()) {
+      CountProgressionPerRegion();
+    }
 
     //copy all not yet placed advancement items so that we can apply their effects for the fill algorithm
     std::vector<ItemKey> itemsToNotPlace = FilterFromPool(ItemPool, [](const ItemKey i){ return ItemTable(i).IsAdvancement();});
@@ -620,7 +836,7 @@ static void AssumedFill(const std::vector<ItemKey>& items, const std::vector<Loc
       }
 
       //get all accessible locations that are allowed
-      const std::vector<LocationKey> accessibleLocations = GetAccessibleLocations(allowedLocations);
+      const std::vector<LocationKey> accessibleLocations = GetAccessibleLocations(allowedLocations, SearchMode::TargetedSearch);
 
       //retry if there are no more locations to place items
       if (accessibleLocations.empty()) {
@@ -646,7 +862,7 @@ static void AssumedFill(const std::vector<ItemKey>& items, const std::vector<Loc
       }
 
       //place the item within one of the allowed locations
-      LocationKey selectedLocation = RandomElement(accessibleLocations);
+      LocationKey selectedLocation = SelectPlacementLocation(item, accessibleLocations);
       PlaceItemInLocation(selectedLocation, item);
       attemptedLocations.push_back(selectedLocation);
 
@@ -751,6 +967,64 @@ static void FillExcludedLocations() {
   }
 }
 
+//Returns the fewest small keys of the given dungeon needed to logically reach each
+//empty location in the pool, assuming every other unplaced advancement item is owned.
+//A location that needs every key can never hold one, so counting stops one key short
+//and such locations are left out of the map along with the unreachable ones.
+static std::map<LocationKey, u8> GetSmallKeyRequirements(const Dungeon::DungeonInfo* dungeon, std::vector<LocationKey>& dungeonLocations, size_t keyCount) {
+  std::map<LocationKey, u8> requirements;
+  const size_t emptyLocations = GetEmptyLocations(dungeonLocations).size();
+  std::vector<ItemKey> itemsToNotPlace = FilterFromPool(ItemPool, [](const ItemKey i){ return ItemTable(i).IsAdvancement();});
+
+  for (size_t keys = 0; keys < keyCount && requirements.size() < emptyLocations; keys++) {
+    LogicReset();
+    for (ItemKey unplacedItem : itemsToNotPlace) {
+      ItemTable(unplacedItem).ApplyEffect();
+    }
+    for (size_t i = 0; i < keys; i++) {
+      ItemTable(dungeon->GetSmallKey()).ApplyEffect();
+    }
+
+    //emplace won't overwrite, so each location keeps the lowest key count it was reached with
+    for (LocationKey loc : GetAccessibleLocations(dungeonLocations, SearchMode::TargetedSearch)) {
+      requirements.emplace(loc, keys);
+    }
+  }
+  return requirements;
+}
+
+//Places the small keys of a dungeon so that it can always be completed. The key placed
+//for the nth door may only go somewhere reachable with n-1 keys, so the keys can be
+//collected in order no matter which doors get opened first. Keys are placed from the
+//last door down so that the later keys have the whole dungeon to choose from.
+static bool PlaceOwnDungeonSmallKeys(const Dungeon::DungeonInfo* dungeon, const std::vector<ItemKey>& smallKeys, std::vector<LocationKey>& dungeonLocations) {
+  const std::map<LocationKey, u8> requirements = GetSmallKeyRequirements(dungeon, dungeonLocations, smallKeys.size());
+  std::vector<LocationKey> placedLocations;
+
+  for (size_t door = smallKeys.size(); door > 0; door--) {
+    std::vector<LocationKey> candidates = FilterFromPool(dungeonLocations, [&requirements, door](const LocationKey loc){
+      auto requirement = requirements.find(loc);
+      return requirement != requirements.end() && requirement->second < door && Location(loc)->GetPlacedItemKey() == NONE;
+    });
+
+    if (candidates.empty()) {
+      PlacementLog_Msg("\nCOULD NOT SOLVE SMALL KEYS FOR " + dungeon->GetName() + ". FALLING BACK TO ASSUMED FILL...\n");
+      for (LocationKey loc : placedLocations) {
+        Location(loc)->SetPlacedItem(NONE);
+        itemsPlaced--;
+      }
+      return false;
+    }
+
+    ItemKey key = smallKeys[door - 1];
+    ItemTable(key).SetAsPlaythrough();
+    LocationKey selectedLocation = RandomElement(candidates);
+    PlaceItemInLocation(selectedLocation, key);
+    placedLocations.push_back(selectedLocation);
+  }
+  return true;
+}
+
 //Function to handle the Own Dungeon setting
 static void RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
   std::vector<LocationKey> dungeonLocations = dungeon->GetDungeonLocations();
@@ -779,7 +1053,15 @@ static void RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
         AddElementsToPool(dungeonItems, dungeonBossKey);
   }
 
-  //randomize boss key and small keys together for even distribution
+  //Individual small keys are placed against the dungeon's key requirements instead of
+  //being retried by assumed fill whenever one lands behind its own door. Key rings are
+  //a single item, so they're left to assumed fill.
+  std::vector<ItemKey> individualKeys = FilterFromPool(dungeonItems, [dungeon](const ItemKey i){ return i == dungeon->GetSmallKey();});
+  if (!individualKeys.empty() && Settings::Logic.IsNot(LOGIC_NONE) && PlaceOwnDungeonSmallKeys(dungeon, individualKeys, dungeonLocations)) {
+    FilterAndEraseFromPool(dungeonItems, [dungeon](const ItemKey i){ return i == dungeon->GetSmallKey();});
+  }
+
+  //randomize boss key and any remaining small keys together for even distribution
   AssumedFill(dungeonItems, dungeonLocations);
 
   //randomize map and compass separately since they're not progressive
@@ -912,129 +1194,601 @@ void ClearProgress() {
   printf("\x1b[11;10H                                  "); // Writing Spoiler Log...Done
 }
 
-int Fill() {
+//Places everything that stays in the world it belongs to: the shop items, dungeon rewards, songs and
+//dungeon items with restricted location pools, and Link's Pocket. In a multiworld this runs once for every
+//world. Returns false if the entrances couldn't be shuffled.
+static bool FillRestrictedItems() {
+  placementRegions.clear();
+  AreaTable_Init(); //Reset the world graph to intialize the proper locations
+  ItemReset(); //Reset shops incase of shopsanity random
+  GenerateLocationPool();
+  GenerateItemPool();
+  GenerateStartingInventory();
+  RemoveStartingItemsFromPool();
+  FillExcludedLocations();
 
-  int retries = 0;
-  while(retries < 5) {
-    placementFailure = false;
-    showItemProgress = false;
-    playthroughLocations.clear();
-    playthroughEntrances.clear();
-    wothLocations.clear();
-    AreaTable_Init(); //Reset the world graph to intialize the proper locations
-    ItemReset(); //Reset shops incase of shopsanity random
-    GenerateLocationPool();
-    GenerateItemPool();
-    GenerateStartingInventory();
-    RemoveStartingItemsFromPool();
-    FillExcludedLocations();
-
-    //Temporarily add shop items to the ItemPool so that entrance randomization
-    //can validate the world using deku/hylian shields
-    AddElementsToPool(ItemPool, GetMinVanillaShopItems(32)); //assume worst case shopsanity 4
-    if (ShuffleEntrances) {
-      printf("\x1b[7;10HShuffling Entrances");
-      if (ShuffleAllEntrances() == ENTRANCE_SHUFFLE_FAILURE) {
-        retries++;
-        ClearProgress();
+  //Temporarily add shop items to the ItemPool so that entrance randomization
+  //can validate the world using deku/hylian shields
+  AddElementsToPool(ItemPool, GetMinVanillaShopItems(32)); //assume worst case shopsanity 4
+  if (ShuffleEntrances) {
+    printf("\x1b[7;10HShuffling Entrances");
+    if (ShuffleAllEntrances() == ENTRANCE_SHUFFLE_FAILURE) {
+      return false;
+    }
+    printf("\x1b[7;32HDone");
+  }
+  //erase temporary shop items
+  FilterAndEraseFromPool(ItemPool, [](const ItemKey item){return ItemTable(item).GetItemType() == ITEMTYPE_SHOP;});
+
+  showItemProgress = true;
+  //Place shop items first, since a buy shield is needed to place a dungeon reward on Gohma due to access
+  NonShopItems = {};
+  if (Shopsanity.Is(SHOPSANITY_OFF)) {
+    PlaceVanillaShopItems(); //Place vanilla shop items in vanilla location
+  } else {
+    int total_replaced = 0;
+    if (Shopsanity.IsNot(SHOPSANITY_ZERO)) { //Shopsanity 1-4, random
+      //Initialize NonShopItems
+      ItemAndPrice init;
+      init.Name = Text{"No Item", "Pas d'objet", "Sin objeto", "Nessun Oggetto", "Deutsch"};
+      init.Price = -1;
+      init.Repurchaseable = false;
+      NonShopItems.assign(32, init);
+      //Indices from OoTR. So shopsanity one will overwrite 7, three will overwrite 7, 5, 8, etc.
+      const std::array<int, 4> indices = {7, 5, 8, 6};
+      //Overwrite appropriate number of shop items
+      for (size_t i = 0; i < ShopLocationLists.size(); i++) {
+        int num_to_replace = GetShopsanityReplaceAmount(); //1-4 shop items will be overwritten, depending on settings
+        total_replaced += num_to_replace;
+        for (int j = 0; j < num_to_replace; j++) {
+          int itemindex = indices[j];
+          int shopsanityPrice = GetRandomShopPrice();
+          NonShopItems[TransformShopIndex(i*8+itemindex-1)].Price = shopsanityPrice; //Set price to be retrieved by the patch and textboxes
+          Location(ShopLocationLists[i][itemindex - 1])->SetShopsanityPrice(shopsanityPrice);
+        }
+      }
+    }
+    //Get all locations and items that don't have a shopsanity price attached
+    std::vector<LocationKey> shopLocations = {};
+    //Get as many vanilla shop items as the total number of shop items minus the number of replaced items
+    //So shopsanity 0 will get all 64 vanilla items, shopsanity 4 will get 32, etc.
+    std::vector<ItemKey> shopItems = GetMinVanillaShopItems(total_replaced);
+
+    for (size_t i = 0; i < ShopLocationLists.size(); i++) {
+      for (size_t j = 0; j < ShopLocationLists[i].size(); j++) {
+        LocationKey loc = ShopLocationLists[i][j];
+        if (!(Location(loc)->HasShopsanityPrice())) {
+          shopLocations.push_back(loc);
+        }
+      }
+    }
+    //Place the shop items which will still be at shop locations
+    AssumedFill(shopItems, shopLocations);
+  }
+
+  //Place dungeon rewards
+  RandomizeDungeonRewards();
+
+  //Place dungeon items restricted to their Own Dungeon
+  for (auto dungeon : Dungeon::dungeonList) {
+    RandomizeOwnDungeon(dungeon);
+  }
+
+  //Then Place songs if song shuffle is set to specific locations
+  if (ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
+
+    //Get each song
+    std::vector<ItemKey> songs = FilterAndEraseFromPool(ItemPool, [](const ItemKey i) { return ItemTable(i).GetItemType() == ITEMTYPE_SONG;});
+
+    //Get each song location
+    std::vector<LocationKey> songLocations;
+    if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
+      songLocations = FilterFromPool(allLocations, [](const LocationKey loc){ return Location(loc)->IsCategory(Category::cSong);});
+
+    } else if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
+      songLocations = FilterFromPool(allLocations, [](const LocationKey loc){ return Location(loc)->IsCategory(Category::cSongDungeonReward);});
+    }
+
+    AssumedFill(songs, songLocations, true);
+  }
+
+  //Then place dungeon items that are assigned to restrictive location pools
+  RandomizeDungeonItems();
+
+  //Then place Link's Pocket Item if it has to be an advancement item
+  RandomizeLinksPocket();
+  return true;
+}
+
+//Multiworld
+//The worlds are filled together. Each world first places the items that have to stay in it, with a seed of
+//its own. Then the rest of the advancement items of every world go through one assumed fill over the
+//locations of all the worlds, so any item can end up in any world.
+struct OwnedItem {
+  ItemKey item;
+  u8 owner;
+};
+
+struct WorldLocation {
+  u8 world;
+  LocationKey loc;
+};
+
+//Which worlds could be beaten in the last multiworld search, and where its search of each world stopped
+static std::vector<bool> worldsBeaten;
+static std::vector<WorldSearch> worldSearches;
+
+//Puts a world back in the state the last multiworld search left it in
+static void ResumeWorldSearch(u8 world) {
+  Multiworld::LoadWorld(world);
+  LogicReset();
+  ApplyStartingInventory();
+  for (ItemKey item : worldSearches[world].items) {
+    ItemTable(item).ApplyEffect();
+  }
+  RestoreWorldSearch(worldSearches[world]);
+}
+
+//Searches every world with the items it's assumed to have. Items a world finds for another player are given
+//to that player, and the search of every world that received something goes on with them, until none of
+//them finds anything new. Returns the empty allowed locations each world can reach, in the order they were
+//found. Stops as soon as goalWorld can be beaten, if one is given.
+static std::vector<std::vector<LocationKey>> SearchMultiworld(const std::vector<std::vector<ItemKey>>& assumedItems, SearchMode mode, std::string ignore = "", int goalWorld = -1) {
+  const u8 worldCount = Multiworld::WorldCount();
+  worldSearches.assign(worldCount, {});
+  std::vector<bool> searchAgain(worldCount, true);
+  std::vector<std::vector<LocationKey>> accessibleLocations(worldCount);
+  worldsBeaten.assign(worldCount, false);
+  for (u8 world = 0; world < worldCount; world++) {
+    worldSearches[world].items = assumedItems[world];
+  }
+
+  searchingMultiworld = true;
+  bool itemsReceived = true;
+  while (itemsReceived) {
+    itemsReceived = false;
+    for (u8 world = 0; world < worldCount; world++) {
+      if (!searchAgain[world]) {
         continue;
       }
-      printf("\x1b[7;32HDone");
+      searchAgain[world] = false;
+
+      Multiworld::LoadWorld(world);
+      LogicReset();
+      playthroughBeatable = false;
+      foundItemLocations.clear();
+      accessibleLocations[world] = SearchWorld(allLocations, mode, ignore, false, false, &worldSearches[world]);
+      worldsBeaten[world] = playthroughBeatable;
+      if (world == goalWorld && worldsBeaten[world]) {
+        searchingMultiworld = false;
+        return accessibleLocations;
+      }
+
+      //A location is only ever found once, since the search goes on from where it stopped
+      for (LocationKey loc : foundItemLocations) {
+        const u8 owner = Multiworld::GetOwner(world, loc);
+        worldSearches[owner].items.push_back(Multiworld::GetPlacedItem(world, loc));
+        searchAgain[owner] = true;
+        itemsReceived = true;
+      }
     }
-    //erase temporary shop items
-    FilterAndEraseFromPool(ItemPool, [](const ItemKey item){return ItemTable(item).GetItemType() == ITEMTYPE_SHOP;});
+  }
+  searchingMultiworld = false;
+  return accessibleLocations;
+}
 
-    showItemProgress = true;
-    //Place shop items first, since a buy shield is needed to place a dungeon reward on Gohma due to access
-    NonShopItems = {};
-    if (Shopsanity.Is(SHOPSANITY_OFF)) {
-      PlaceVanillaShopItems(); //Place vanilla shop items in vanilla location
-    } else {
-      int total_replaced = 0;
-      if (Shopsanity.IsNot(SHOPSANITY_ZERO)) { //Shopsanity 1-4, random
-        //Initialize NonShopItems
-        ItemAndPrice init;
-        init.Name = Text{"No Item", "Pas d'objet", "Sin objeto", "Nessun Oggetto", "Deutsch"};
-        init.Price = -1;
-        init.Repurchaseable = false;
-        NonShopItems.assign(32, init);
-        //Indices from OoTR. So shopsanity one will overwrite 7, three will overwrite 7, 5, 8, etc.
-        const std::array<int, 4> indices = {7, 5, 8, 6};
-        //Overwrite appropriate number of shop items
-        for (size_t i = 0; i < ShopLocationLists.size(); i++) {
-          int num_to_replace = GetShopsanityReplaceAmount(); //1-4 shop items will be overwritten, depending on settings
-          total_replaced += num_to_replace;
-          for (int j = 0; j < num_to_replace; j++) {
-            int itemindex = indices[j];
-            int shopsanityPrice = GetRandomShopPrice();
-            NonShopItems[TransformShopIndex(i*8+itemindex-1)].Price = shopsanityPrice; //Set price to be retrieved by the patch and textboxes
-            Location(ShopLocationLists[i][itemindex - 1])->SetShopsanityPrice(shopsanityPrice);
+static bool AllWorldsBeatable() {
+  SearchMultiworld(std::vector<std::vector<ItemKey>>(Multiworld::WorldCount()), SearchMode::CheckBeatable);
+  return std::all_of(worldsBeaten.begin(), worldsBeaten.end(), [](const bool beaten){ return beaten; });
+}
+
+static bool WorldBeatable(u8 world, std::string ignore = "") {
+  SearchMultiworld(std::vector<std::vector<ItemKey>>(Multiworld::WorldCount()), SearchMode::CheckBeatable, ignore, world);
+  return worldsBeaten[world];
+}
+
+//Link's Pocket is given when the file is created, so it can't hold an item for another player
+static bool CanHoldItem(const WorldLocation& location, const OwnedItem& item) {
+  return location.loc != LINKS_POCKET || location.world == item.owner;
+}
+
+static void MultiworldPlaceItem(const WorldLocation& location, const OwnedItem& item) {
+  PlacementLog_Msg("\n");
+  PlacementLog_Msg(ItemTable(item.item).GetName().GetNAEnglish());
+  PlacementLog_Msg(" for player " + std::to_string(item.owner + 1) + " placed at ");
+  PlacementLog_Msg(Location(location.loc)->GetName());
+  PlacementLog_Msg(" in world " + std::to_string(location.world + 1) + "\n\n");
+  Multiworld::PlaceItem(location.world, location.loc, item.item, item.owner);
+  itemsPlaced++;
+}
+
+//Like FastFill, over the empty locations of every world
+static void MultiworldFastFill(std::vector<OwnedItem> items) {
+  std::vector<WorldLocation> locations;
+  for (u8 world = 0; world < Multiworld::WorldCount(); world++) {
+    for (LocationKey loc : allLocations) {
+      if (Multiworld::GetPlacedItem(world, loc) == NONE) {
+        locations.push_back({world, loc});
+      }
+    }
+  }
+  Shuffle(locations);
+  Shuffle(items);
+  for (const OwnedItem& item : items) {
+    auto location = std::find_if(locations.begin(), locations.end(), [&item](const WorldLocation& loc){ return CanHoldItem(loc, item); });
+    if (location == locations.end()) {
+      placementFailure = true;
+      return;
+    }
+    MultiworldPlaceItem(*location, item);
+    locations.erase(location);
+  }
+}
+
+//Progression Spread counts the advancement items in the hint regions of each world separately
+static std::vector<std::map<HintKey, int>> worldProgressionPerRegion;
+
+static void CountMultiworldProgressionPerRegion() {
+  worldProgressionPerRegion.assign(Multiworld::WorldCount(), {});
+  if (ProgressionSpread.Is(0)) {
+    return;
+  }
+  for (u8 world = 0; world < Multiworld::WorldCount(); world++) {
+    for (LocationKey loc : allLocations) {
+      ItemKey item = Multiworld::GetPlacedItem(world, loc);
+      if (item != NONE && ItemTable(item).IsAdvancement()) {
+        worldProgressionPerRegion[world][GetPlacementRegion(loc)]++;
+      }
+    }
+  }
+}
+
+//Same as SelectPlacementLocation, over the locations every world can reach. Progression Depth weighs each
+//location by how late it was found in its own world.
+static WorldLocation SelectMultiworldPlacementLocation(const OwnedItem& item, const std::vector<std::vector<LocationKey>>& accessibleLocations, const std::vector<WorldLocation>& candidates) {
+  if (!PlacementBiasEnabled()) {
+    return RandomElement(candidates);
+  }
+
+  std::vector<u32> weights;
+  weights.reserve(candidates.size());
+  for (u8 world = 0; world < accessibleLocations.size(); world++) {
+    const size_t count = accessibleLocations[world].size();
+    for (size_t i = 0; i < count; i++) {
+      const LocationKey loc = accessibleLocations[world][i];
+      if (!CanHoldItem({world, loc}, item)) {
+        continue;
+      }
+      auto placed = worldProgressionPerRegion[world].find(GetPlacementRegion(loc));
+      weights.push_back(GetPlacementWeight(i, count, placed != worldProgressionPerRegion[world].end() ? placed->second : 0));
+    }
+  }
+  WorldLocation selected = candidates[WeightedSampler(weights).Draw()];
+  if (!ProgressionSpread.Is(0)) {
+    worldProgressionPerRegion[selected.world][GetPlacementRegion(selected.loc)]++;
+  }
+  return selected;
+}
+
+//Same as AssumedFill, with every world assuming it has all of its own unplaced items
+static void MultiworldAssumedFill(const std::vector<OwnedItem>& items) {
+  if (Settings::Logic.Is(LOGIC_NONE)) {
+    MultiworldFastFill(items);
+    return;
+  }
+
+  const u8 worldCount = Multiworld::WorldCount();
+  int retries = 10;
+  bool unsuccessfulPlacement = false;
+  std::vector<WorldLocation> attemptedLocations;
+  do {
+    retries--;
+    if (retries <= 0) {
+      placementFailure = true;
+      return;
+    }
+    unsuccessfulPlacement = false;
+    std::vector<OwnedItem> itemsToPlace = items;
+    if (PlacementBiasEnabled()) {
+      CountMultiworldProgressionPerRegion();
+    }
+
+    Shuffle(itemsToPlace);
+    while (!itemsToPlace.empty()) {
+      OwnedItem item = itemsToPlace.back();
+      ItemTable(item.item).SetAsPlaythrough();
+      itemsToPlace.pop_back();
+
+      std::vector<std::vector<ItemKey>> assumedItems(worldCount);
+      for (const OwnedItem& unplacedItem : itemsToPlace) {
+        assumedItems[unplacedItem.owner].push_back(unplacedItem.item);
+      }
+      const std::vector<std::vector<LocationKey>> accessibleLocations = SearchMultiworld(assumedItems, SearchMode::TargetedSearch);
+
+      std::vector<WorldLocation> candidates;
+      for (u8 world = 0; world < worldCount; world++) {
+        for (LocationKey loc : accessibleLocations[world]) {
+          if (CanHoldItem({world, loc}, item)) {
+            candidates.push_back({world, loc});
           }
         }
       }
-      //Get all locations and items that don't have a shopsanity price attached
-      std::vector<LocationKey> shopLocations = {};
-      //Get as many vanilla shop items as the total number of shop items minus the number of replaced items
-      //So shopsanity 0 will get all 64 vanilla items, shopsanity 4 will get 32, etc.
-      std::vector<ItemKey> shopItems = GetMinVanillaShopItems(total_replaced);
 
-      for (size_t i = 0; i < ShopLocationLists.size(); i++) {
-        for (size_t j = 0; j < ShopLocationLists[i].size(); j++) {
-          LocationKey loc = ShopLocationLists[i][j];
-          if (!(Location(loc)->HasShopsanityPrice())) {
-            shopLocations.push_back(loc);
-          }
+      //retry if there are no more locations to place items
+      if (candidates.empty()) {
+        PlacementLog_Msg("\nCANNOT PLACE ");
+        PlacementLog_Msg(ItemTable(item.item).GetName().GetNAEnglish());
+        PlacementLog_Msg(" FOR PLAYER " + std::to_string(item.owner + 1) + ". TRYING AGAIN...\n");
+
+        //reset any locations that got an item
+        for (const WorldLocation& location : attemptedLocations) {
+          Multiworld::PlaceItem(location.world, location.loc, NONE, location.world);
+          itemsPlaced--;
         }
+        attemptedLocations.clear();
+
+        unsuccessfulPlacement = true;
+        break;
+      }
+
+      WorldLocation selectedLocation = SelectMultiworldPlacementLocation(item, accessibleLocations, candidates);
+      MultiworldPlaceItem(selectedLocation, item);
+      attemptedLocations.push_back(selectedLocation);
+
+      //If ALR is off, stop placing items with logic once every player can finish
+      if (!LocationsReachable && AllWorldsBeatable()) {
+        PlacementLog_Msg("All worlds beatable, now placing items randomly. " + std::to_string(itemsToPlace.size()) + " major items remaining.\n\n");
+        MultiworldFastFill(itemsToPlace);
+        return;
       }
-      //Place the shop items which will still be at shop locations
-      AssumedFill(shopItems, shopLocations);
     }
+  } while (unsuccessfulPlacement);
+}
+
+//Everyone has to be able to finish, but the playthrough is only written for this player's world. The
+//spheres go over all of the worlds at once, so the items sent by the other players count from the sphere
+//they're found in.
+static void GenerateMultiworldPlaythrough() {
+  playthroughBeatable = AllWorldsBeatable();
+  if (!playthroughBeatable) {
+    return;
+  }
 
-    //Place dungeon rewards
-    RandomizeDungeonRewards();
+  const u8 worldCount = Multiworld::WorldCount();
+  const u8 ownWorld = Multiworld::OwnWorld();
+  worldSearches.assign(worldCount, {});
+  size_t ownAreasListed = 0;
+  PlaythroughFilter playthroughFilter;
+  playthroughFilter.maxGsCount = GetMaxGSCount();
+
+  //Items are only collected between spheres, so every world is searched without collecting what it finds
+  searchingMultiworld = true;
+  deferFoundItems = true;
+  bool ownWorldBeaten = false;
+  while (!ownWorldBeaten) {
+    std::vector<WorldLocation> sphere;
+    std::vector<LocationKey> ownSphere;
+    for (u8 world = 0; world < worldCount && !ownWorldBeaten; world++) {
+      Multiworld::LoadWorld(world);
+      LogicReset();
+      playthroughBeatable = false;
+      foundItemLocations.clear();
+      SearchWorld(allLocations, SearchMode::CheckBeatable, "", false, false, &worldSearches[world]);
+
+      //The shuffled entrances of the areas this player's world reached in this sphere
+      if (world == ownWorld) {
+        const std::vector<AreaKey>& areaPool = worldSearches[world].areaPool;
+        std::list<Entrance*> entranceSphere;
+        for (; ownAreasListed < areaPool.size(); ownAreasListed++) {
+          for (Entrance& exit : AreaTable(areaPool[ownAreasListed])->exits) {
+            AddToEntranceSphere(exit, entranceSphere);
+          }
+        }
+        if (!entranceSphere.empty()) {
+          playthroughEntrances.push_back(entranceSphere);
+        }
+      }
 
-    //Place dungeon items restricted to their Own Dungeon
-    for (auto dungeon : Dungeon::dungeonList) {
-      RandomizeOwnDungeon(dungeon);
+      for (LocationKey loc : foundItemLocations) {
+        sphere.push_back({world, loc});
+        if (world != ownWorld) {
+          continue;
+        }
+        //Triforce has been found, nothing else in this sphere matters
+        if (playthroughBeatable) {
+          if (Location(loc)->GetPlacedItemKey() == TRIFORCE) {
+            ownSphere = {loc};
+            ownWorldBeaten = true;
+          }
+        } else if (Location(loc)->GetPlacedItem().IsAdvancement() && !playthroughFilter.Exclude(Location(loc))) {
+          ownSphere.push_back(loc);
+        }
+      }
     }
 
-    //Then Place songs if song shuffle is set to specific locations
-    if (ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
+    if (sphere.empty()) {
+      break;
+    }
+    for (const WorldLocation& location : sphere) {
+      worldSearches[Multiworld::GetOwner(location.world, location.loc)].items.push_back(Multiworld::GetPlacedItem(location.world, location.loc));
+    }
+    if (!ownSphere.empty()) {
+      playthroughLocations.push_back(ownSphere);
+    }
+  }
+  searchingMultiworld = false;
+  deferFoundItems = false;
+  playthroughBeatable = ownWorldBeaten;
+}
 
-      //Get each song
-      std::vector<ItemKey> songs = FilterAndEraseFromPool(ItemPool, [](const ItemKey i) { return ItemTable(i).GetItemType() == ITEMTYPE_SONG;});
+//Same as PareDownPlaythrough, for this player's world
+static void PareDownMultiworldPlaythrough() {
+  const u8 ownWorld = Multiworld::OwnWorld();
+  std::vector<std::pair<LocationKey, ItemKey>> toAddBackItem;
+  //Start at sphere before Ganon's and count down
+  for (int i = playthroughLocations.size() - 2; i >= 0; i--) {
+    std::vector<LocationKey> sphere = playthroughLocations.at(i);
+    for (int j = sphere.size() - 1; j >= 0; j--) {
+      LocationKey loc = sphere.at(j);
+      ItemKey copy = Multiworld::GetPlacedItem(ownWorld, loc);
+      Multiworld::SetPlacedItem(ownWorld, loc, NONE);
+      if (WorldBeatable(ownWorld, GetPlaythroughIgnore(copy))) {
+        playthroughLocations[i].erase(playthroughLocations[i].begin() + j);
+        toAddBackItem.push_back({loc, copy}); //Game is still beatable, don't add back until later
+      } else {
+        Multiworld::SetPlacedItem(ownWorld, loc, copy);
+      }
+    }
+  }
+
+  //Some spheres may now be empty, remove these
+  for (int i = playthroughLocations.size() - 2; i >= 0; i--) {
+    if (playthroughLocations.at(i).size() == 0) {
+      playthroughLocations.erase(playthroughLocations.begin() + i);
+    }
+  }
 
-      //Get each song location
-      std::vector<LocationKey> songLocations;
-      if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
-        songLocations = FilterFromPool(allLocations, [](const LocationKey loc){ return Location(loc)->IsCategory(Category::cSong);});
+  for (const auto& [loc, item] : toAddBackItem) {
+    Multiworld::SetPlacedItem(ownWorld, loc, item);
+  }
+}
 
-      } else if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
-        songLocations = FilterFromPool(allLocations, [](const LocationKey loc){ return Location(loc)->IsCategory(Category::cSongDungeonReward);});
+//Same as CalculateWotH, the items in this player's world which someone needs for this player to finish
+static void CalculateMultiworldWotH() {
+  const u8 ownWorld = Multiworld::OwnWorld();
+  Multiworld::LoadWorld(ownWorld);
+  for (size_t i = 0; i < playthroughLocations.size() - 1; i++) {
+    for (LocationKey loc : playthroughLocations[i]) {
+      if (Location(loc)->IsHintable()) {
+        wothLocations.push_back(loc);
       }
+    }
+  }
 
-      AssumedFill(songs, songLocations, true);
+  for (int i = wothLocations.size() - 1; i >= 0; i--) {
+    LocationKey loc = wothLocations[i];
+    ItemKey copy = Multiworld::GetPlacedItem(ownWorld, loc);
+    Multiworld::SetPlacedItem(ownWorld, loc, NONE);
+    const bool beatable = WorldBeatable(ownWorld);
+    Multiworld::SetPlacedItem(ownWorld, loc, copy);
+    if (beatable) {
+      wothLocations.erase(wothLocations.begin() + i);
+    } else {
+      //The search of this player's world got as far as it goes without the item
+      ResumeWorldSearch(ownWorld);
+      WothRequirements::RecordWithout(loc);
+    }
+  }
+
+  //The rest of generation only looks at this player's world, with everything the others send it
+  playthroughBeatable = true;
+  Multiworld::LoadWorld(ownWorld);
+  LogicReset();
+  GetAccessibleLocations(allLocations);
+
+  //Compare what each Way of the Hero item's search could open with everything collected
+  WothRequirements::Build();
+}
+
+//Shuffling a world's entrances can fail, in which case it's tried again from where the world's randomness
+//left off. That makes the world come out the same on every console.
+static bool FillWorldRestrictedItems(u32 seed) {
+  Random_Init(seed);
+  Multiworld::UnloadWorld();
+  for (int tries = 0; tries < 5; tries++) {
+    if (FillRestrictedItems()) {
+      return true;
     }
+    ClearProgress();
+  }
+  return false;
+}
 
-    //Then place dungeon items that are assigned to restrictive location pools
-    RandomizeDungeonItems();
+static bool FillMultiworld() {
+  const u8 worldCount = Multiworld::WorldCount();
+  const u8 ownWorld = Multiworld::OwnWorld();
+  //Every console generates every world, so they all draw the same seeds here
+  std::vector<u32> worldSeeds;
+  for (u8 world = 0; world <= worldCount; world++) {
+    worldSeeds.push_back(Random(0, 0x7FFFFFFF));
+  }
 
-    //Then place Link's Pocket Item if it has to be an advancement item
-    RandomizeLinksPocket();
-    //Then place the rest of the advancement items
-    std::vector<ItemKey> remainingAdvancementItems = FilterAndEraseFromPool(ItemPool, [](const ItemKey i) { return ItemTable(i).IsAdvancement();});
-    AssumedFill(remainingAdvancementItems, allLocations, true);
+  Multiworld::Reset();
+  std::vector<OwnedItem> advancementItems;
+  for (u8 world = 0; world < worldCount; world++) {
+    if (!FillWorldRestrictedItems(worldSeeds[world])) {
+      return false;
+    }
+    for (ItemKey item : FilterAndEraseFromPool(ItemPool, [](const ItemKey i) { return ItemTable(i).IsAdvancement();})) {
+      advancementItems.push_back({item, world});
+    }
+    Multiworld::SaveWorld(world);
+  }
 
-    //Fast fill for the rest of the pool
+  //The last seed is for everything the worlds do together
+  Random_Init(worldSeeds[worldCount]);
+  MultiworldAssumedFill(advancementItems);
+
+  //Fast fill for the rest of each world's pool
+  for (u8 world = 0; world < worldCount; world++) {
+    Multiworld::LoadWorld(world);
     std::vector<ItemKey> remainingPool = FilterAndEraseFromPool(ItemPool, [](const ItemKey i) {return true;});
     FastFill(remainingPool, GetAllEmptyLocations(), false);
-    GeneratePlaythrough();
+    Multiworld::SaveWorld(world);
+  }
+
+  GenerateMultiworldPlaythrough();
+  if (!playthroughBeatable || placementFailure) {
+    return false;
+  }
+
+  //The rest of generation is for this player's world, just as the fill left it
+  Multiworld::LoadWorld(ownWorld);
+  Multiworld::CollectReceivedItems();
+  return true;
+}
+
+int Fill() {
+
+  int retries = 0;
+  while(retries < 5) {
+    placementFailure = false;
+    showItemProgress = false;
+    playthroughLocations.clear();
+    playthroughEntrances.clear();
+    wothLocations.clear();
+    if (Multiworld::IsEnabled()) {
+      if (!FillMultiworld()) {
+        retries++;
+        ClearProgress();
+        continue;
+      }
+    } else {
+      if (!FillRestrictedItems()) {
+        retries++;
+        ClearProgress();
+        continue;
+      }
+      //Then place the rest of the advancement items
+      std::vector<ItemKey> remainingAdvancementItems = FilterAndEraseFromPool(ItemPool, [](const ItemKey i) { return ItemTable(i).IsAdvancement();});
+      AssumedFill(remainingAdvancementItems, allLocations, true);
+
+      //Fast fill for the rest of the pool
+      std::vector<ItemKey> remainingPool = FilterAndEraseFromPool(ItemPool, [](const ItemKey i) {return true;});
+      FastFill(remainingPool, GetAllEmptyLocations(), false);
+      GeneratePlaythrough();
+    }
     //Successful placement, produced beatable result
     if(playthroughBeatable && !placementFailure) {
       printf("Done");
       printf("\x1b[9;10HCalculating Playthrough...");
-      PareDownPlaythrough();
-      CalculateWotH();
+      if (Multiworld::IsEnabled()) {
+        PareDownMultiworldPlaythrough();
+        CalculateMultiworldWotH();
+      } else {
+        PareDownPlaythrough();
+        CalculateWotH();
+      }
       printf("Done");
       CreateItemOverrides();
       CreateEntranceOverrides();
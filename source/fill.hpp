@@ -9,6 +9,7 @@
 
 enum class SearchMode {
   ReachabilitySearch,
+  TargetedSearch, //Only finds the given empty locations, stopping as soon as all of them are reached
   GeneratePlaythrough,
   CheckBeatable,
   AllLocationsReachable,
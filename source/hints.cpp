@@ -13,6 +13,8 @@
 #include "entrance.hpp"
 #include "settings.hpp"
 
+#include <map>
+
 using namespace CustomMessages;
 using namespace Logic;
 using namespace Settings;
@@ -112,7 +114,9 @@ std::array<DungeonInfo, 10> dungeonInfoData;
 
 
 
-static Area* GetHintRegion(const AreaKey area) {
+//With useVanillaEntrances, shuffled entrances are followed back to where they originally came from,
+//so the region found doesn't give away where an area was shuffled to
+static Area* GetHintRegion(const AreaKey area, const bool useVanillaEntrances = false) {
 
   std::vector<AreaKey> alreadyChecked = {};
   std::vector<AreaKey> spotQueue = {area};
@@ -129,15 +133,19 @@ static Area* GetHintRegion(const AreaKey area) {
     //add unchecked entrances to spot queue
     bool checked = false;
     for (auto& entrance : AreaTable(region)->entrances) {
+      AreaKey parentRegion = entrance->GetParentRegionKey();
+      if (useVanillaEntrances && entrance->IsShuffled() && entrance->GetReplacement() != nullptr) {
+        parentRegion = entrance->GetReplacement()->GetParentRegionKey();
+      }
       for (AreaKey checkedEntrance : alreadyChecked) {
-        if (entrance->GetParentRegionKey() == checkedEntrance) {
+        if (parentRegion == checkedEntrance) {
           checked = true;
           break;
         }
       }
 
       if (!checked) {
-        spotQueue.insert(spotQueue.begin(), entrance->GetParentRegionKey());
+        spotQueue.insert(spotQueue.begin(), parentRegion);
       }
     }
   }
@@ -149,8 +157,8 @@ HintKey GetHintRegionHintKey(const AreaKey area) {
   return GetHintRegion(area)->hintKey;
 }
 
-HintKey GetLocationRegionHintKey(const LocationKey location) {
-  return GetHintRegion(Location(location)->GetParentRegionKey())->hintKey;
+HintKey GetLocationRegionHintKey(const LocationKey location, const bool useVanillaEntrances /*= false*/) {
+  return GetHintRegion(Location(location)->GetParentRegionKey(), useVanillaEntrances)->hintKey;
 }
 
 static std::vector<LocationKey> GetAccessibleGossipStones(const LocationKey hintedLocation = GANON) {
@@ -160,7 +168,7 @@ static std::vector<LocationKey> GetAccessibleGossipStones(const LocationKey hint
   Location(hintedLocation)->SetPlacedItem(NONE);
 
   LogicReset();
-  auto accessibleGossipStones = GetAccessibleLocations(gossipStoneLocations);
+  auto accessibleGossipStones = GetAccessibleLocations(gossipStoneLocations, SearchMode::TargetedSearch);
   //Give the item back to the location
   Location(hintedLocation)->SetPlacedItem(originalItem);
 
@@ -380,7 +388,7 @@ static void CreateJunkHint() {
   //duplicate junk hints are possible for now
   const HintText junkHint = RandomElement(GetHintCategory(HintCategory::Junk));
   LogicReset();
-  const std::vector<LocationKey> gossipStones = GetAccessibleLocations(gossipStoneLocations);
+  const std::vector<LocationKey> gossipStones = GetAccessibleLocations(gossipStoneLocations, SearchMode::TargetedSearch);
   if (gossipStones.empty()) {
     PlacementLog_Msg("\tNO GOSSIP STONES TO PLACE HINT\n\n");
     return;
@@ -425,6 +433,27 @@ static std::vector<LocationKey> CalculateBarrenRegions() {
   return finalBarrenLocations;
 }
 
+//Same regions as CalculateBarrenRegions, but looks up each location's region only once
+std::vector<HintKey> GetBarrenRegions() {
+  std::map<HintKey, bool> regionIsUseful;
+  for (LocationKey loc : allLocations) {
+    HintKey region = GetLocationRegionHintKey(loc);
+    if (Location(loc)->GetPlacedItem().IsMajorItem() || ElementInContainer(loc, wothLocations)) {
+      regionIsUseful[region] = true;
+    } else if (loc != LINKS_POCKET) {
+      regionIsUseful.emplace(region, false);
+    }
+  }
+
+  std::vector<HintKey> regions = {};
+  for (const auto& [region, useful] : regionIsUseful) {
+    if (!useful) {
+      regions.push_back(region);
+    }
+  }
+  return regions;
+}
+
 static void CreateTrialHints() {
     //six trials
   if (RandomGanonsTrials && GanonsTrialsCount.Is(6)) {
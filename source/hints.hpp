@@ -177,6 +177,14 @@ public:
         return clearText;
     }
 
+    //Same as GetClear, but uses the first obscure text instead of a random one
+    const Text& GetClearOrFirstObscure() const {
+        if (clearText.GetNAEnglish().empty()) {
+            return obscureText.front();
+        }
+        return clearText;
+    }
+
     const Text& GetText() const {
         if (Settings::ClearerHints.Is(HINTMODE_OBSCURE)) {
             return GetObscure();
@@ -225,5 +233,8 @@ extern std::array<DungeonInfo, 10> dungeonInfoData;
 extern std::array<ConditionalAlwaysHint, 9> conditionalAlwaysHints;
 
 extern HintKey GetHintRegionHintKey(const AreaKey area);
+extern HintKey GetLocationRegionHintKey(const LocationKey location, const bool useVanillaEntrances = false);
 extern void CreateAllHints();
+//Hint regions with nothing useful in them, i.e. the ones barren hints can name
+extern std::vector<HintKey> GetBarrenRegions();
 extern void CreateMerchantsHints();
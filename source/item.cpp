@@ -64,8 +64,7 @@ void Item::UndoEffect() {
 }
 
 ItemOverride_Value Item::Value() const {
-    ItemOverride_Value val;
-    val.all = 0;
+    ItemOverride_Value val = {};
     val.itemId = getItemId;
     if (getItemId == GI_ICE_TRAP) {
         val.looksLikeItemId = RandomElement(IceTrapModels);
@@ -8,7 +8,7 @@
 #include "hint_list.hpp"
 #include "settings.hpp"
 
-union ItemOverride_Value;
+struct ItemOverride_Value;
 
 enum ItemType {
     ITEMTYPE_ITEM,
@@ -6,6 +6,10 @@
 #include "shops.hpp"
 #include "debug.hpp"
 #include "keys.hpp"
+#include "multiworld.hpp"
+#include "random.hpp"
+
+#include <map>
 
 //Location definitions
 static std::array<ItemLocation, KEY_ENUM_MAX> locationTable;
@@ -1561,14 +1565,68 @@ void AddExcludedOptions() {
   }
 }
 
+//With the Item Pool and Nearby Items disguises, ice traps look like one of the items that was actually
+//placed, so every item is as likely a disguise as it is common. With Nearby Items, the items placed in
+//the trap's own region are in the draw a few more times.
+#define NEARBY_DISGUISE_WEIGHT 4
+
+static std::vector<u16> disguisePool;
+static std::map<SpoilerCollectionCheckGroup, std::vector<u16>> nearbyDisguisePools;
+
+static void BuildIceTrapDisguisePools() {
+  disguisePool.clear();
+  nearbyDisguisePools.clear();
+  for (LocationKey locKey : allLocations) {
+    auto loc = Location(locKey);
+    const Item& item = loc->GetPlacedItem();
+    ItemType type = item.GetItemType();
+    if (loc->GetPlacedItemKey() == ICE_TRAP || type == ITEMTYPE_EVENT || type == ITEMTYPE_DROP ||
+        type == ITEMTYPE_SHOP || type == ITEMTYPE_DUNGEONREWARD || type == ITEMTYPE_TOKEN) {
+      continue;
+    }
+    //Look like the item as it would be shown, so uncolored keys stay uncolored
+    ItemOverride_Value itemVal = item.Value();
+    u16 looksLike = itemVal.looksLikeItemId != 0 ? itemVal.looksLikeItemId : itemVal.itemId;
+    disguisePool.push_back(looksLike);
+    nearbyDisguisePools[loc->GetCollectionCheckGroup()].push_back(looksLike);
+  }
+}
+
+static u16 GetIceTrapDisguise(LocationKey locKey, u16 majorItemModel) {
+  if (Settings::IceTrapDisguises.Is(ICETRAPDISGUISES_MAJOR) || disguisePool.empty()) {
+    return majorItemModel;
+  }
+  size_t total = disguisePool.size();
+  const std::vector<u16>* nearby = nullptr;
+  if (Settings::IceTrapDisguises.Is(ICETRAPDISGUISES_NEARBY)) {
+    nearby = &nearbyDisguisePools[Location(locKey)->GetCollectionCheckGroup()];
+    total += nearby->size() * (NEARBY_DISGUISE_WEIGHT - 1);
+  }
+  //The nearby items are already in the whole pool once, the rest of their weight comes after it
+  size_t pick = Random(0, total);
+  if (pick < disguisePool.size()) {
+    return disguisePool[pick];
+  }
+  return (*nearby)[(pick - disguisePool.size()) % nearby->size()];
+}
+
 void CreateItemOverrides() {
   PlacementLog_Msg("NOW CREATING OVERRIDES\n\n");
+  BuildIceTrapDisguisePools();
   for (LocationKey locKey : allLocations) {
     auto loc = Location(locKey);
     ItemOverride_Value val = ItemTable(loc->GetPlacedItemKey()).Value();
-    //If this is an ice trap in a shop, change the name based on what the model will look like
-    if (loc->GetPlacedItemKey() == ICE_TRAP && loc->IsCategory(Category::cShop)) {
-      NonShopItems[TransformShopIndex(GetShopIndex(locKey))].Name = GetIceTrapName(val.looksLikeItemId);
+    if (loc->GetPlacedItemKey() == ICE_TRAP) {
+      val.looksLikeItemId = GetIceTrapDisguise(locKey, val.looksLikeItemId);
+      val.trapSeed = Random(1, 0x10000);
+      //If this is an ice trap in a shop, change the name based on what the model will look like
+      if (loc->IsCategory(Category::cShop)) {
+        NonShopItems[TransformShopIndex(GetShopIndex(locKey))].Name = GetIceTrapName(val.looksLikeItemId);
+      }
+    }
+    //Items for another player of a multiworld have that player's number
+    if (Multiworld::IsForeign(locKey)) {
+      val.player = Multiworld::GetOwner(Multiworld::OwnWorld(), locKey) + 1;
     }
     overrides.insert({
       .key = loc->Key(),
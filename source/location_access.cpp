@@ -26,17 +26,8 @@ std::vector<EventAccess> grottoEvents = {
 };
 
 //set the logic to be a specific age and time of day and see if the condition still holds
-bool LocationAccess::CheckConditionAtAgeTime(bool& age, bool& time) const {
-
-  IsChild = false;
-  IsAdult = false;
-  AtDay   = false;
-  AtNight = false;
-
-  time = true;
-  age = true;
-
-  UpdateHelpers();
+bool LocationAccess::CheckConditionAtAgeTime(u8 ageTime) const {
+  Areas::SetLogicAgeTime(ageTime);
   return GetConditionsMet();
 }
 
@@ -45,16 +36,18 @@ bool LocationAccess::ConditionsMet() const {
   Area* parentRegion = AreaTable(Location(location)->GetParentRegionKey());
   bool conditionsMet = false;
 
-  if ((parentRegion->childDay   && CheckConditionAtAgeTime(IsChild, AtDay))   ||
-      (parentRegion->childNight && CheckConditionAtAgeTime(IsChild, AtNight)) ||
-      (parentRegion->adultDay   && CheckConditionAtAgeTime(IsAdult, AtDay))   ||
-      (parentRegion->adultNight && CheckConditionAtAgeTime(IsAdult, AtNight))) {
-        conditionsMet = true;
+  for (u8 ageTime = AGETIME_CHILD_DAY; ageTime <= AGETIME_ADULT_NIGHT && !conditionsMet; ageTime <<= 1) {
+    conditionsMet = (parentRegion->ageTimeAccess & ageTime) && CheckConditionAtAgeTime(ageTime);
   }
 
   return conditionsMet && CanBuy();
 }
 
+bool LocationAccess::SearchConditionsMet() const {
+  Area* parentRegion = AreaTable(Location(location)->GetParentRegionKey());
+  return CheckAgeTimes(parentRegion->ageTimeAccess, true, [this](u8 ageTime){return CheckConditionAtAgeTime(ageTime);}) && CanBuy();
+}
+
 bool LocationAccess::CanBuy() const {
   //Not a shop location, don't need to check if buyable
   if (!(Location(location)->IsCategory(Category::cShop))) {
@@ -105,16 +98,12 @@ bool Area::UpdateEvents(SearchMode mode) {
 
   if (timePass && mode != SearchMode::TimePassAccess) {
     if (Child()) {
-      childDay = true;
-      childNight = true;
-      AreaTable(ROOT)->childDay = true;
-      AreaTable(ROOT)->childNight = true;
+      AddAgeTimes(AGETIME_CHILD);
+      AreaTable(ROOT)->AddAgeTimes(AGETIME_CHILD);
     }
     if (Adult()) {
-      adultDay = true;
-      adultNight = true;
-      AreaTable(ROOT)->adultDay = true;
-      AreaTable(ROOT)->adultNight = true;
+      AddAgeTimes(AGETIME_ADULT);
+      AreaTable(ROOT)->AddAgeTimes(AGETIME_ADULT);
     }
   }
 
@@ -126,10 +115,7 @@ bool Area::UpdateEvents(SearchMode mode) {
       continue;
     }
 
-    if ((childDay   && event.CheckConditionAtAgeTime(IsChild, AtDay))    ||
-        (childNight && event.CheckConditionAtAgeTime(IsChild, AtNight))  ||
-        (adultDay   && event.CheckConditionAtAgeTime(IsAdult, AtDay))    ||
-        (adultNight && event.CheckConditionAtAgeTime(IsAdult, AtNight))) {
+    if (event.SearchAgeTimes(ageTimeAccess)) {
           event.EventOccurred();
           eventsUpdated = true;
     }
@@ -201,20 +187,17 @@ bool Area::CheckAllAccess(const AreaKey exitKey) {
 
   for (Entrance& exit : exits) {
     if (exit.GetAreaKey() == exitKey) {
-      return exit.CheckConditionAtAgeTime(Logic::IsChild, Logic::AtDay)   &&
-             exit.CheckConditionAtAgeTime(Logic::IsChild, Logic::AtNight) &&
-             exit.CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtDay)   &&
-             exit.CheckConditionAtAgeTime(Logic::IsAdult, Logic::AtNight);
+      return exit.CheckConditionAtAgeTime(AGETIME_CHILD_DAY)   &&
+             exit.CheckConditionAtAgeTime(AGETIME_CHILD_NIGHT) &&
+             exit.CheckConditionAtAgeTime(AGETIME_ADULT_DAY)   &&
+             exit.CheckConditionAtAgeTime(AGETIME_ADULT_NIGHT);
     }
   }
   return false;
 }
 
 void Area::ResetVariables() {
-  childDay = false;
-  childNight = false;
-  adultDay = false;
-  adultNight = false;
+  ageTimeAccess = 0;
   addedToPool = false;
   for (auto& exit : exits) {
     exit.RemoveFromPool();
@@ -770,6 +753,15 @@ namespace Areas {
     GANONS_CASTLE_MQ_LIGHT_TRIAL,
   };
 
+  //Sets the logic age and time of day to a single AgeTime flag to check a condition at
+  void SetLogicAgeTime(u8 ageTime) {
+    IsChild = ageTime & AGETIME_CHILD;
+    IsAdult = ageTime & AGETIME_ADULT;
+    AtDay   = ageTime & (AGETIME_CHILD_DAY | AGETIME_ADULT_DAY);
+    AtNight = ageTime & (AGETIME_CHILD_NIGHT | AGETIME_ADULT_NIGHT);
+    UpdateHelpers();
+  }
+
   void AccessReset() {
     for (const AreaKey area : allAreas) {
       AreaTable(area)->ResetVariables();
@@ -777,15 +769,15 @@ namespace Areas {
 
     if(Settings::HasNightStart) {
         if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childNight = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_CHILD_NIGHT);
         } else {
-          AreaTable(ROOT)->adultNight = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_ADULT_NIGHT);
         }
       } else {
         if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childDay = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_CHILD_DAY);
         } else {
-          AreaTable(ROOT)->adultDay = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_ADULT_DAY);
         }
     }
   }
@@ -803,19 +795,47 @@ namespace Areas {
 
     if(Settings::HasNightStart) {
         if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childNight = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_CHILD_NIGHT);
         } else {
-          AreaTable(ROOT)->adultNight = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_ADULT_NIGHT);
         }
       } else {
         if(Settings::ResolvedStartingAge == AGE_CHILD) {
-          AreaTable(ROOT)->childDay = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_CHILD_DAY);
         } else {
-          AreaTable(ROOT)->adultDay = true;
+          AreaTable(ROOT)->AddAgeTimes(AGETIME_ADULT_DAY);
         }
     }
   }
 
+  static std::array<u8, allAreas.size()> validatedAccess;
+  static bool validatedAccessSaved = false;
+
+  //Remember the access from a world validation search that passed, since the
+  //areas will be overwritten by any searches that come after it
+  void SaveValidatedAccess() {
+    for (size_t i = 0; i < allAreas.size(); i++) {
+      validatedAccess[i] = AreaTable(allAreas[i])->ageTimeAccess;
+    }
+    validatedAccessSaved = true;
+  }
+
+  //Limit all later searches to the access from the last world validation that passed
+  void ApplyValidatedAccess() {
+    if (!validatedAccessSaved) {
+      return;
+    }
+    for (size_t i = 0; i < allAreas.size(); i++) {
+      AreaTable(allAreas[i])->maxAgeTimeAccess = validatedAccess[i];
+    }
+    validatedAccessSaved = false;
+  }
+
+  //Forget the saved access once the connections it was validated on are undone
+  void ClearValidatedAccess() {
+    validatedAccessSaved = false;
+  }
+
   bool HasTimePassAccess(u8 age) {
     for (const AreaKey areaKey : allAreas) {
       auto area = AreaTable(areaKey);
@@ -826,6 +846,23 @@ namespace Areas {
     return false;
   }
 
+  static std::string AgeTimeAccessString(u8 ageTimeAccess) {
+    std::string str = "";
+    if (ageTimeAccess & AGETIME_CHILD_DAY) {
+      str += " CD";
+    }
+    if (ageTimeAccess & AGETIME_CHILD_NIGHT) {
+      str += " CN";
+    }
+    if (ageTimeAccess & AGETIME_ADULT_DAY) {
+      str += " AD";
+    }
+    if (ageTimeAccess & AGETIME_ADULT_NIGHT) {
+      str += " AN";
+    }
+    return str;
+  }
+
   // Will dump a file which can be turned into a visual graph using graphviz
   // https://graphviz.org/download/
   // Use command: dot -Tsvg <filename> -o world.svg
@@ -839,33 +876,9 @@ namespace Areas {
       auto area = AreaTable(areaKey);
       for (auto exit : area->exits) {
         if (exit.GetConnectedRegion()->regionName != "Invalid Area") {
-          std::string parent = exit.GetParentRegion()->regionName;
-          if (area->childDay) {
-            parent += " CD";
-          }
-          if (area->childNight) {
-            parent += " CN";
-          }
-          if (area->adultDay) {
-            parent += " AD";
-          }
-          if (area->adultNight) {
-            parent += " AN";
-          }
+          std::string parent = exit.GetParentRegion()->regionName + AgeTimeAccessString(area->ageTimeAccess);
           Area* connected = exit.GetConnectedRegion();
-          auto connectedStr = connected->regionName;
-          if (connected->childDay) {
-            connectedStr += " CD";
-          }
-          if (connected->childNight) {
-            connectedStr += " CN";
-          }
-          if (connected->adultDay) {
-            connectedStr += " AD";
-          }
-          if (connected->adultNight) {
-            connectedStr += " AN";
-          }
+          auto connectedStr = connected->regionName + AgeTimeAccessString(connected->ageTimeAccess);
           worldGraph << "\t\"" + parent + "\"[shape=\"plain\"];\n";
           worldGraph << "\t\"" + connectedStr + "\"[shape=\"plain\"];\n";
           worldGraph << "\t\"" + parent + "\" -> \"" + connectedStr + "\"\n";
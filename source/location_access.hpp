@@ -11,6 +11,36 @@
 
 typedef bool (*ConditionFn)();
 
+//Each combination of age and time of day an area can be accessed at, packed into a bitmask
+enum AgeTimeFlags : u8 {
+  AGETIME_CHILD_DAY   = 0x01,
+  AGETIME_CHILD_NIGHT = 0x02,
+  AGETIME_ADULT_DAY   = 0x04,
+  AGETIME_ADULT_NIGHT = 0x08,
+  AGETIME_CHILD       = AGETIME_CHILD_DAY | AGETIME_CHILD_NIGHT,
+  AGETIME_ADULT       = AGETIME_ADULT_DAY | AGETIME_ADULT_NIGHT,
+  AGETIME_ALL         = AGETIME_CHILD | AGETIME_ADULT,
+};
+
+namespace Areas {
+  void SetLogicAgeTime(u8 ageTime);
+} //namespace Areas
+
+//Checks a condition at each of the given ages and times of day, and returns the ones it's met at
+template <typename CheckFn>
+u8 CheckAgeTimes(u8 ageTimes, bool stopAtFirstPass, CheckFn check) {
+    u8 passed = 0;
+    for (u8 ageTime = AGETIME_CHILD_DAY; ageTime <= AGETIME_ADULT_NIGHT; ageTime <<= 1) {
+        if ((ageTimes & ageTime) && check(ageTime)) {
+            passed |= ageTime;
+            if (stopAtFirstPass) {
+                break;
+            }
+        }
+    }
+    return passed;
+}
+
 class EventAccess {
 public:
 
@@ -38,20 +68,16 @@ public:
         return false;
     }
 
-    bool CheckConditionAtAgeTime(bool& age, bool& time) {
-
-      Logic::IsChild = false;
-      Logic::IsAdult = false;
-      Logic::AtDay   = false;
-      Logic::AtNight = false;
-
-      time = true;
-      age = true;
-
-      Logic::UpdateHelpers();
+    bool CheckConditionAtAgeTime(u8 ageTime) const {
+      Areas::SetLogicAgeTime(ageTime);
       return ConditionsMet();
     }
 
+    //Returns which of the given ages and times of day the event can happen at
+    u8 SearchAgeTimes(u8 ageTimes, bool stopAtFirstPass = true) const {
+      return CheckAgeTimes(ageTimes, stopAtFirstPass, [this](u8 ageTime){return CheckConditionAtAgeTime(ageTime);});
+    }
+
     void EventOccurred() {
         *event = true;
     }
@@ -92,20 +118,23 @@ public:
         return false;
     }
 
-    bool CheckConditionAtAgeTime(bool& age, bool& time) const;
+    bool CheckConditionAtAgeTime(u8 ageTime) const;
 
     bool ConditionsMet() const;
 
+    //Same as ConditionsMet, but checks the ages and times of day as bits of the parent area's access
+    bool SearchConditionsMet() const;
+
     LocationKey GetLocation() const {
         return location;
     }
 
+    //Makes sure shop locations are buyable
+    bool CanBuy() const;
+
 private:
     LocationKey location;
     std::vector<ConditionFn> conditions_met;
-
-    //Makes sure shop locations are buyable
-    bool CanBuy() const;
 };
 
 class Entrance;
@@ -135,10 +164,12 @@ public:
     //worry about a vector potentially reallocating itself and invalidating all our
     //entrance pointers.
 
-    bool childDay = false;
-    bool childNight = false;
-    bool adultDay = false;
-    bool adultNight = false;
+    u8   ageTimeAccess = 0;
+    //Every age and time of day this area was reachable at when entrance shuffle last
+    //validated the world with all items assumed. Searches that assume fewer items can
+    //never reach more than this, so they skip checking for anything outside of it.
+    //Not cleared between searches, only when the world graph is rebuilt.
+    u8   maxAgeTimeAccess = AGETIME_ALL;
     bool addedToPool = false;
 
     bool UpdateEvents(SearchMode mode);
@@ -151,12 +182,25 @@ public:
 
     Entrance* GetExit(AreaKey exit);
 
+    //Gives access at the given ages and times of day, returns true if the access grew
+    bool AddAgeTimes(u8 ageTimes) {
+      if ((ageTimeAccess | ageTimes) == ageTimeAccess) {
+        return false;
+      }
+      ageTimeAccess |= ageTimes;
+      return true;
+    }
+
+    void RemoveAgeTimes(u8 ageTimes) {
+      ageTimeAccess &= ~ageTimes;
+    }
+
     bool Child() const {
-      return childDay || childNight;
+      return ageTimeAccess & AGETIME_CHILD;
     }
 
     bool Adult() const {
-      return adultDay || adultNight;
+      return ageTimeAccess & AGETIME_ADULT;
     }
 
     bool BothAgesCheck() const {
@@ -168,7 +212,7 @@ public:
     }
 
     bool AllAccess() const {
-      return childDay && childNight && adultDay && adultNight;
+      return ageTimeAccess == AGETIME_ALL;
     }
 
     //Check to see if an exit can be access as both ages at both times of day
@@ -210,10 +254,10 @@ public:
     void ResetVariables();
 
     void printAgeTimeAccess() const {
-      auto message = "Child Day:   " + std::to_string(childDay)   + "\t"
-                     "Child Night: " + std::to_string(childNight) + "\t"
-                     "Adult Day:   " + std::to_string(adultDay)   + "\t"
-                     "Adult Night: " + std::to_string(adultNight);
+      auto message = "Child Day:   " + std::to_string((ageTimeAccess & AGETIME_CHILD_DAY) != 0)   + "\t"
+                     "Child Night: " + std::to_string((ageTimeAccess & AGETIME_CHILD_NIGHT) != 0) + "\t"
+                     "Adult Day:   " + std::to_string((ageTimeAccess & AGETIME_ADULT_DAY) != 0)   + "\t"
+                     "Adult Night: " + std::to_string((ageTimeAccess & AGETIME_ADULT_NIGHT) != 0);
       CitraPrint(message);
     }
 };
@@ -235,6 +279,9 @@ namespace Areas {
 
   extern void AccessReset();
   extern void ResetAllLocations();
+  extern void SaveValidatedAccess();
+  extern void ApplyValidatedAccess();
+  extern void ClearValidatedAccess();
   extern bool HasTimePassAccess(u8 age);
   extern void DumpWorldGraph(std::string str);
 } //namespace Exits
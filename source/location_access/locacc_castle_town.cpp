@@ -183,7 +183,7 @@ void AreaTable_Init_CastleTown() {
   areaTable[MARKET_MASK_SHOP] = Area("Market Mask Shop", "", NONE, NO_DAY_NIGHT_CYCLE, {
                   //Events
                   EventAccess(&SkullMask,   {[]{return SkullMask   || (ZeldasLetter && (CompleteMaskQuest ||  ChildCanAccess(KAKARIKO_VILLAGE)));}}),
-                  EventAccess(&MaskOfTruth, {[]{return MaskOfTruth || (SkullMask && (CompleteMaskQuest || (ChildCanAccess(THE_LOST_WOODS) && CanPlay(SariasSong) && AreaTable(THE_GRAVEYARD)->childDay && ChildCanAccess(HYRULE_FIELD) && HasAllStones)));}}),
+                  EventAccess(&MaskOfTruth, {[]{return MaskOfTruth || (SkullMask && (CompleteMaskQuest || (ChildCanAccess(THE_LOST_WOODS) && CanPlay(SariasSong) && (AreaTable(THE_GRAVEYARD)->ageTimeAccess & AGETIME_CHILD_DAY) && ChildCanAccess(HYRULE_FIELD) && HasAllStones)));}}),
                 }, {}, {
                   //Exits
                   Entrance(THE_MARKET, {[]{return true;}}),
@@ -12,6 +12,7 @@
 #include "patch.hpp"
 #include "preset.hpp"
 #include "randomizer.hpp"
+#include "seed_farm.hpp"
 #include "settings.hpp"
 #include "spoiler_log.hpp"
 #include "location_access.hpp"
@@ -661,6 +662,11 @@ void GenerateRandomizer() {
     const int count = std::stoi(Settings::seed.substr(18), nullptr);
     Playthrough::Playthrough_Repeat(count);
     return;
+  } else if (Settings::seed.rfind("seed_farm_", 0) == 0) {
+    const int count = std::stoi(Settings::seed.substr(10), nullptr);
+    SeedFarm::Run(count);
+    RestoreOverrides();
+    return;
   }
 
   int ret = Playthrough::Playthrough_Init(std::hash<std::string>{}(Settings::seed));
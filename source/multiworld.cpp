@@ -0,0 +1,229 @@
+#include "multiworld.hpp"
+
+#include "entrance.hpp"
+#include "item_list.hpp"
+#include "item_location.hpp"
+#include "item_pool.hpp"
+#include "location_access.hpp"
+#include "settings.hpp"
+#include "shops.hpp"
+
+#include <list>
+
+namespace Multiworld {
+
+  struct LocationState {
+    ItemKey item;
+    u16 price;
+    bool shopsanityPrice;
+    bool hintable;
+    bool hidden;
+  };
+
+  //The item locations of every world are kept here, and of the loaded world also in the item locations. The
+  //rest of a world's state stays in the world graph and the other globals for as long as it's loaded, and is
+  //only moved here when another world takes its place. Exits and entrances are moved as whole lists, so the
+  //entrances entrance shuffle linked up keep pointing at each other.
+  struct World {
+    std::vector<LocationState> locations;          //Indexed by location key
+    std::vector<u8> owners;                        //Indexed by location key
+    std::vector<std::list<Entrance>> exits;        //Indexed by area key
+    std::vector<std::list<Entrance*>> entrances;   //Indexed by area key
+    std::vector<u8> maxAgeTimeAccess;              //Indexed by area key
+    std::vector<ItemKey> itemPool;
+    std::vector<ItemAndPrice> nonShopItems;
+    std::array<u32, 9> dungeonRewardOverrides;
+    u32 linksPocketRewardBitMask;
+    bool noRandomEntrances;
+  };
+
+  static std::vector<World> worlds;
+  static u8 loadedWorld = 0;
+  static bool worldLoaded = false;
+  static std::vector<ItemKey> receivedItems;
+  static bool receivedItemsCollected = false;
+
+  bool IsEnabled() {
+    return Settings::MW_Players.Value<u8>() > 0;
+  }
+
+  u8 WorldCount() {
+    return Settings::MW_Players.Value<u8>() + 1;
+  }
+
+  u8 OwnWorld() {
+    return IsEnabled() ? Settings::MW_PlayerId.Value<u8>() : 0;
+  }
+
+  void Reset() {
+    worlds.clear();
+    worlds.resize(WorldCount());
+    loadedWorld = 0;
+    worldLoaded = false;
+    receivedItems.clear();
+    receivedItemsCollected = false;
+  }
+
+  std::vector<LocationKey> GetWorldLocations() {
+    std::vector<LocationKey> locations = allLocations;
+    locations.insert(locations.end(), dungeonRewardLocations.begin(), dungeonRewardLocations.end());
+    return locations;
+  }
+
+  static LocationState GetLocationState(const ItemLocation* location) {
+    return LocationState{
+      .item = location->GetPlacedItemKey(),
+      .price = location->GetPrice(),
+      .shopsanityPrice = location->HasShopsanityPrice(),
+      .hintable = location->IsHintable(),
+      .hidden = location->IsHidden(),
+    };
+  }
+
+  static bool HasLocationState(const ItemLocation* location, const LocationState& state) {
+    return location->GetPlacedItemKey() == state.item && location->HasShopsanityPrice() == state.shopsanityPrice &&
+           (!state.shopsanityPrice || location->GetPrice() == state.price) &&
+           location->IsHintable() == state.hintable && location->IsHidden() == state.hidden;
+  }
+
+  //Moves the loaded world's graph and the rest of its globals out of the way
+  static void StashLoadedWorld() {
+    if (!worldLoaded) {
+      return;
+    }
+    World& saved = worlds[loadedWorld];
+    saved.exits.resize(areaTable.size());
+    saved.entrances.resize(areaTable.size());
+    saved.maxAgeTimeAccess.resize(areaTable.size());
+    for (size_t i = 0; i < areaTable.size(); i++) {
+      saved.exits[i] = std::move(areaTable[i].exits);
+      saved.entrances[i] = std::move(areaTable[i].entrances);
+      saved.maxAgeTimeAccess[i] = areaTable[i].maxAgeTimeAccess;
+    }
+    saved.itemPool = std::move(ItemPool);
+    saved.nonShopItems = std::move(NonShopItems);
+    saved.dungeonRewardOverrides = Settings::rDungeonRewardOverrides;
+    saved.linksPocketRewardBitMask = Settings::LinksPocketRewardBitMask;
+    saved.noRandomEntrances = noRandomEntrances;
+    worldLoaded = false;
+  }
+
+  void SaveWorld(u8 world) {
+    World& saved = worlds[world];
+    if (saved.owners.empty()) {
+      saved.owners.assign(KEY_ENUM_MAX, world);
+    }
+
+    saved.locations.resize(KEY_ENUM_MAX);
+    for (LocationKey loc : GetWorldLocations()) {
+      saved.locations[loc] = GetLocationState(Location(loc));
+    }
+
+    loadedWorld = world;
+    worldLoaded = true;
+  }
+
+  void LoadWorld(u8 world) {
+    if (worldLoaded && loadedWorld == world) {
+      return;
+    }
+    StashLoadedWorld();
+    World& saved = worlds[world];
+
+    //Only the locations that differ from the world that was loaded before are changed
+    for (LocationKey loc : GetWorldLocations()) {
+      ItemLocation* location = Location(loc);
+      const LocationState& state = saved.locations[loc];
+      if (HasLocationState(location, state)) {
+        continue;
+      }
+      location->ResetVariables();
+      if (state.shopsanityPrice) {
+        location->SetShopsanityPrice(state.price);
+      }
+      location->SetPlacedItem(state.item);
+      if (state.hintable) {
+        location->SetAsHintable();
+      }
+      location->SetHidden(state.hidden);
+    }
+
+    for (size_t i = 0; i < areaTable.size(); i++) {
+      areaTable[i].exits = std::move(saved.exits[i]);
+      areaTable[i].entrances = std::move(saved.entrances[i]);
+      areaTable[i].maxAgeTimeAccess = saved.maxAgeTimeAccess[i];
+    }
+    ItemPool = std::move(saved.itemPool);
+    NonShopItems = std::move(saved.nonShopItems);
+    Settings::rDungeonRewardOverrides = saved.dungeonRewardOverrides;
+    Settings::LinksPocketRewardBitMask = saved.linksPocketRewardBitMask;
+    noRandomEntrances = saved.noRandomEntrances;
+    loadedWorld = world;
+    worldLoaded = true;
+  }
+
+  void UnloadWorld() {
+    StashLoadedWorld();
+  }
+
+  ItemKey GetPlacedItem(u8 world, LocationKey loc) {
+    return worlds[world].locations[loc].item;
+  }
+
+  u8 GetOwner(u8 world, LocationKey loc) {
+    return worlds[world].owners[loc];
+  }
+
+  bool IsForeign(LocationKey loc) {
+    return worldLoaded && worlds[loadedWorld].owners[loc] != loadedWorld;
+  }
+
+  void SetPlacedItem(u8 world, LocationKey loc, ItemKey item) {
+    worlds[world].locations[loc].item = item;
+    if (worldLoaded && world == loadedWorld) {
+      Location(loc)->SetPlacedItem(item);
+    }
+  }
+
+  void PlaceItem(u8 world, LocationKey loc, ItemKey item, u8 owner) {
+    SetPlacedItem(world, loc, item);
+    worlds[world].owners[loc] = owner;
+    worlds[world].locations[loc].hintable = true;
+    const bool loaded = worldLoaded && world == loadedWorld;
+    if (loaded) {
+      Location(loc)->SetAsHintable();
+    }
+
+    //Same as PlaceItemInLocation, the shop's textbox has to name the item
+    if (item != NONE && ItemTable(item).GetItemType() != ITEMTYPE_SHOP && Location(loc)->IsCategory(Category::cShop)) {
+      ItemAndPrice& shopItem = (loaded ? NonShopItems : worlds[world].nonShopItems)[TransformShopIndex(GetShopIndex(loc))];
+      shopItem.Name = ItemTable(item).GetName();
+      shopItem.Repurchaseable = ItemTable(item).GetItemType() == ITEMTYPE_REFILL || ItemTable(item).GetHintKey() == PROGRESSIVE_BOMBCHUS;
+    }
+  }
+
+  void CollectReceivedItems() {
+    receivedItems.clear();
+    const u8 ownWorld = OwnWorld();
+    for (u8 world = 0; world < worlds.size(); world++) {
+      if (world == ownWorld) {
+        continue;
+      }
+      for (LocationKey loc : GetWorldLocations()) {
+        if (worlds[world].owners[loc] == ownWorld) {
+          receivedItems.push_back(worlds[world].locations[loc].item);
+        }
+      }
+    }
+    receivedItemsCollected = true;
+  }
+
+  void ApplyReceivedItems() {
+    if (!receivedItemsCollected) {
+      return;
+    }
+    for (ItemKey item : receivedItems) {
+      ItemTable(item).ApplyEffect();
+    }
+  }
+} //namespace Multiworld
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <3ds.h>
+
+#include "keys.hpp"
+
+#include <vector>
+
+//A multiworld seed has one world for every player. All of them use the same settings, but each world is
+//shuffled on its own and the items in it can belong to any player. The world graph and item locations can
+//only hold one world at a time, so every world's placements, entrance graph, shops and dungeon rewards are
+//kept here and swapped into them whenever that world is searched. Every console generates all of the
+//worlds, and then keeps its own player's world loaded for the patch.
+namespace Multiworld {
+  bool IsEnabled();
+  u8 WorldCount();
+  //The world of the player this console generates for
+  u8 OwnWorld();
+
+  //Forgets every saved world, for a new generation attempt
+  void Reset();
+  //Copies the item locations into the given world, and makes the world graph, item pool, shop items and
+  //dungeon rewards that are currently in place its own. Items placed directly into the item locations
+  //belong to the world they're in.
+  void SaveWorld(u8 world);
+  //Puts the given world's item locations, world graph, item pool, shop items and dungeon rewards in place
+  void LoadWorld(u8 world);
+  //Called before the world graph and item locations are built up for a world again. The loaded world is
+  //moved out of the way, and until the new one is saved none of the items in it belong to another player.
+  void UnloadWorld();
+
+  ItemKey GetPlacedItem(u8 world, LocationKey loc);
+  u8 GetOwner(u8 world, LocationKey loc);
+  //Whether the item at a location of the loaded world belongs to another player
+  bool IsForeign(LocationKey loc);
+  //Places an item chosen by the fill, which makes the location hintable
+  void PlaceItem(u8 world, LocationKey loc, ItemKey item, u8 owner);
+  //Changes the item at a location without changing who it belongs to, for taking an item out and putting it back
+  void SetPlacedItem(u8 world, LocationKey loc, ItemKey item);
+  //Every location in every world that can be given an item
+  std::vector<LocationKey> GetWorldLocations();
+
+  //Once the seed is done, the single world searches that still happen for this player's world (hint
+  //placement) include the items the other players have for it
+  void CollectReceivedItems();
+  void ApplyReceivedItems();
+} //namespace Multiworld
@@ -102,20 +102,21 @@ void WriteFloatToBuffer(std::vector<char>& buffer, float f, size_t offset) {
   memcpy(buffer.data() + offset, &f, sizeof(float));
 }
 
-bool WriteAllPatches() {
+std::string GetTitlePath() {
+  return Settings::Region == REGION_EUR ? "/luma/titles/0004000000033600" : "/luma/titles/0004000000033500";
+}
+
+bool WriteAllPatches(const std::string& titlePath) {
   Result res = 0;
   FS_Archive sdmcArchive = 0;
   Handle code;
   u32 bytesWritten = 0;
   u32 totalRW = 0;
   char buf[512];
-  std::string titleId;
   PatchSymbols patchSymbols;
   if (Settings::Region == REGION_EUR) {
-    titleId = "0004000000033600";
     patchSymbols = EurSymbols;
   } else { // REGION_NA
-    titleId = "0004000000033500";
     patchSymbols = UsaSymbols;
   }
 
@@ -130,11 +131,11 @@ bool WriteAllPatches() {
   //Create the titles directory if it doesn't exist
   FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, "/luma/titles"), FS_ATTRIBUTE_DIRECTORY);
   //Create the 0004000000033500 (33600 for EUR) directory if it doesn't exist (oot3d game id)
-  FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, ("/luma/titles/" + titleId).c_str()), FS_ATTRIBUTE_DIRECTORY);
+  FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, titlePath.c_str()), FS_ATTRIBUTE_DIRECTORY);
   //Create the romfs directory if it doesn't exist (for LayeredFS)
-  FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, ("/luma/titles/" + titleId + "/romfs").c_str()), FS_ATTRIBUTE_DIRECTORY);
+  FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, (titlePath + "/romfs").c_str()), FS_ATTRIBUTE_DIRECTORY);
   //Create the actor directory if it doesn't exist
-  FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, ("/luma/titles/" + titleId + "/romfs/actor").c_str()), FS_ATTRIBUTE_DIRECTORY);
+  FSUSER_CreateDirectory(sdmcArchive, fsMakePath(PATH_ASCII, (titlePath + "/romfs/actor").c_str()), FS_ATTRIBUTE_DIRECTORY);
 
   /*romfs is used to get files from the romfs folder. This allows us to copy
   from basecode and write the exheader without the user needing to worry about
@@ -149,10 +150,10 @@ bool WriteAllPatches() {
   --------------------------*/
 
   // Delete code.ips if it exists
-  FSUSER_DeleteFile(sdmcArchive, fsMakePath(PATH_ASCII, ("/luma/titles/" + titleId + "/code.ips").c_str()));
+  FSUSER_DeleteFile(sdmcArchive, fsMakePath(PATH_ASCII, (titlePath + "/code.ips").c_str()));
 
   // Open code.ips
-  if (!R_SUCCEEDED(res = FSUSER_OpenFile(&code, sdmcArchive, fsMakePath(PATH_ASCII, ("/luma/titles/" + titleId + "/code.ips").c_str()), FS_OPEN_WRITE | FS_OPEN_CREATE, 0))) {
+  if (!R_SUCCEEDED(res = FSUSER_OpenFile(&code, sdmcArchive, fsMakePath(PATH_ASCII, (titlePath + "/code.ips").c_str()), FS_OPEN_WRITE | FS_OPEN_CREATE, 0))) {
     return false;
   }
 
@@ -625,7 +626,7 @@ bool WriteAllPatches() {
     filePath = "romfs:/exheader_citra.bin";
   }
 
-  CopyFile(sdmcArchive, ("/luma/titles/" + titleId + "/exheader.bin").c_str(), filePath);
+  CopyFile(sdmcArchive, (titlePath + "/exheader.bin").c_str(), filePath);
 
   /*-------------------------
   |       custom assets      |
@@ -638,7 +639,7 @@ bool WriteAllPatches() {
 
   // Delete assets if it exists
   Handle assetsOut;
-  std::string assetsOutPath = "/luma/titles/" + titleId + "/romfs/actor/zelda_gi_melody.zar";
+  std::string assetsOutPath = titlePath + "/romfs/actor/zelda_gi_melody.zar";
   const char* assetsInPath = "romfs:/zelda_gi_melody.zar";
   FSUSER_DeleteFile(sdmcArchive, fsMakePath(PATH_ASCII, assetsOutPath.c_str()));
 
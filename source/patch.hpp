@@ -34,4 +34,7 @@ typedef struct {
 extern const PatchSymbols EurSymbols;
 extern const PatchSymbols UsaSymbols;
 
-bool WriteAllPatches();
+//Where Luma looks for the game's patches, e.g. "/luma/titles/0004000000033500"
+std::string GetTitlePath();
+//Writes code.ips, exheader.bin and the romfs files into the given folder, which is laid out like a title folder
+bool WriteAllPatches(const std::string& titlePath = GetTitlePath());
@@ -1,9 +1,12 @@
 #include "playthrough.hpp"
 
 #include "custom_messages.hpp"
+#include "entrance.hpp"
 #include "fill.hpp"
+#include "hints.hpp"
 #include "location_access.hpp"
 #include "logic.hpp"
+#include "multiworld.hpp"
 #include "random.hpp"
 #include "spoiler_log.hpp"
 #include "../code/src/item_override.h"
@@ -13,7 +16,18 @@
 
 namespace Playthrough {
 
-    int Playthrough_Init(u32 seed) {
+    //The playthrough and way of the hero are cleared once the spoiler log is written, so this has to run before
+    static void CollectMetrics(SeedMetrics* metrics) {
+      metrics->spheres = playthroughLocations.size();
+      metrics->wayOfTheHero = wothLocations.size();
+      metrics->barrenRegions = GetBarrenRegions().size();
+      metrics->playthroughEntrances = 0;
+      for (const auto& sphere : playthroughEntrances) {
+        metrics->playthroughEntrances += sphere.size();
+      }
+    }
+
+    int Playthrough_Init(u32 seed, SeedMetrics* metrics /*= nullptr*/) {
       //initialize the RNG with just the seed incase any settings need to be
       //resolved to something random
       Random_Init(seed);
@@ -42,6 +56,7 @@ namespace Playthrough {
       }
       unsigned int finalHash = std::hash<std::string>{}(Settings::seed + settingsStr);
       Random_Init(finalHash);
+      Multiworld::Reset();
 
       Logic::UpdateHelpers();
 
@@ -55,6 +70,14 @@ namespace Playthrough {
         }
       }
 
+      if (metrics != nullptr) {
+        CollectMetrics(metrics);
+      }
+
+      //Every player's hints use up a different amount of randomness, but they all need to see the same hash
+      if (Multiworld::IsEnabled()) {
+        Random_Init(finalHash);
+      }
       GenerateHash();
       WriteIngameSpoilerLog();
 
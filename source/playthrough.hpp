@@ -6,6 +6,14 @@
 #include "../code/include/z3D/z3D.h"
 
 namespace Playthrough {
-    int Playthrough_Init(u32 seed);
+    //Numbers describing a generated seed, used to filter seeds in the seed farm
+    struct SeedMetrics {
+        size_t spheres = 0;
+        size_t wayOfTheHero = 0;
+        size_t barrenRegions = 0;
+        size_t playthroughEntrances = 0;
+    };
+
+    int Playthrough_Init(u32 seed, SeedMetrics* metrics = nullptr);
     int Playthrough_Repeat(int count = 1);
 }
@@ -27,3 +27,40 @@ double RandomDouble() {
     std::uniform_real_distribution<double> distribution(0.0, 1.0);
     return distribution(generator);
 }
+
+WeightedSampler::WeightedSampler(const std::vector<uint32_t>& weights) : threshold(weights.size()), alias(weights.size()) {
+    for (uint32_t weight : weights) {
+        total += weight;
+    }
+    //Every column holds total/n of the weight: part of it its own index, the rest an alias.
+    //Scaling everything by n keeps the split in whole numbers.
+    const uint64_t n = weights.size();
+    std::vector<uint64_t> scaled(n);
+    std::vector<std::size_t> small, large;
+    for (std::size_t i = 0; i < n; i++) {
+        scaled[i] = weights[i] * n;
+        alias[i] = i;
+        (scaled[i] < total ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+        std::size_t s = small.back();
+        small.pop_back();
+        std::size_t l = large.back();
+        large.pop_back();
+        threshold[s] = static_cast<uint32_t>(scaled[s]);
+        alias[s] = l;
+        scaled[l] -= total - scaled[s];
+        (scaled[l] < total ? small : large).push_back(l);
+    }
+    for (std::size_t i : small) {
+        threshold[i] = total;
+    }
+    for (std::size_t i : large) {
+        threshold[i] = total;
+    }
+}
+
+std::size_t WeightedSampler::Draw() const {
+    const std::size_t column = Random(0, threshold.size());
+    return Random(0, total) < threshold[column] ? column : alias[column];
+}
@@ -29,6 +29,19 @@ const auto& RandomElement(const Container& container) {
     return container[Random(0, std::size(container))];
 }
 
+//Draws indexes with probability proportional to their weight, using Walker's alias method.
+//Building it is O(n), after that every draw is O(1).
+class WeightedSampler {
+public:
+    explicit WeightedSampler(const std::vector<uint32_t>& weights);
+    std::size_t Draw() const;
+
+private:
+    uint32_t total = 0;
+    std::vector<uint32_t> threshold;
+    std::vector<std::size_t> alias;
+};
+
 //Shuffle items within a vector or array
 template <typename T>
 void Shuffle(std::vector<T>& vector) {
@@ -0,0 +1,161 @@
+#include "seed_farm.hpp"
+
+#include "fill.hpp"
+#include "patch.hpp"
+#include "playthrough.hpp"
+#include "settings.hpp"
+#include "spoiler_log.hpp"
+#include "tinyxml2.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace SeedFarm {
+
+  using Playthrough::SeedMetrics;
+
+  static const std::string FARM_PATH = "/3ds/seed_farm/";
+
+  static constexpr std::array<std::pair<const char*, size_t SeedMetrics::*>, 4> metricNames = {{
+    {"spheres",               &SeedMetrics::spheres},
+    {"way-of-the-hero",       &SeedMetrics::wayOfTheHero},
+    {"barren-regions",        &SeedMetrics::barrenRegions},
+    {"playthrough-entrances", &SeedMetrics::playthroughEntrances},
+  }};
+
+  struct Filter {
+    size_t SeedMetrics::* metric;
+    unsigned int min;
+    unsigned int max;
+  };
+
+  //Without a filters file every seed that generates is kept
+  static std::vector<Filter> LoadFilters() {
+    using namespace tinyxml2;
+
+    std::vector<Filter> filters = {};
+    XMLDocument doc;
+    if (doc.LoadFile((FARM_PATH + "filters.xml").c_str()) != XML_SUCCESS || doc.RootElement() == nullptr) {
+      return filters;
+    }
+
+    for (XMLElement* node = doc.RootElement()->FirstChildElement("filter"); node != nullptr; node = node->NextSiblingElement("filter")) {
+      const char* name = node->Attribute("metric");
+      if (name == nullptr) {
+        continue;
+      }
+      for (const auto& [metricName, metric] : metricNames) {
+        if (strcmp(name, metricName) == 0) {
+          Filter filter = {metric, node->UnsignedAttribute("min", 0), node->UnsignedAttribute("max", UINT32_MAX)};
+          filters.push_back(filter);
+          break;
+        }
+      }
+    }
+    return filters;
+  }
+
+  static bool PassesFilters(const SeedMetrics& metrics, const std::vector<Filter>& filters) {
+    for (const Filter& filter : filters) {
+      size_t value = metrics.*filter.metric;
+      if (value < filter.min || value > filter.max) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static bool WriteManifest(const std::string& dir, const SeedMetrics& metrics) {
+    auto manifest = tinyxml2::XMLDocument(false);
+    manifest.InsertEndChild(manifest.NewDeclaration());
+
+    auto rootNode = manifest.NewElement("seed-farm-manifest");
+    manifest.InsertEndChild(rootNode);
+    rootNode->SetAttribute("version", Settings::version.c_str());
+    rootNode->SetAttribute("seed", Settings::seed.c_str());
+    rootNode->SetAttribute("hash", GetRandomizerHashAsString().c_str());
+    rootNode->SetAttribute("region", Settings::Region == REGION_EUR ? "EUR" : "USA");
+
+    auto metricsNode = rootNode->InsertNewChildElement("metrics");
+    for (const auto& [metricName, metric] : metricNames) {
+      metricsNode->SetAttribute(metricName, static_cast<unsigned int>(metrics.*metric));
+    }
+
+    auto filesNode = rootNode->InsertNewChildElement("files");
+    filesNode->SetAttribute("patch", "code.ips");
+    filesNode->SetAttribute("exheader", "exheader.bin");
+    if (Settings::GenerateSpoilerLog) {
+      filesNode->SetAttribute("spoiler-log", "spoilerlog.xml");
+      if (Settings::JsonSpoilerLog) {
+        filesNode->SetAttribute("json-spoiler-log", "spoilerlog.json");
+      }
+    }
+
+    return manifest.SaveFile((dir + "manifest.xml").c_str()) == tinyxml2::XML_SUCCESS;
+  }
+
+  //Writes the patch straight into the seed's folder, so the one that's installed is left alone, and moves the
+  //spoiler logs out of the places a normal generation leaves them, so the next seed can't overwrite them
+  static bool Package(const SeedMetrics& metrics) {
+    const std::string dir = FARM_PATH + Settings::seed + "/";
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec || !WriteAllPatches(FARM_PATH + Settings::seed)) {
+      return false;
+    }
+    if (Settings::GenerateSpoilerLog) {
+      fs::rename(GetSpoilerLogPath(), dir + "spoilerlog.xml", ec);
+      if (ec) {
+        return false;
+      }
+      if (Settings::JsonSpoilerLog) {
+        fs::rename(GetJsonSpoilerLogPath(), dir + "spoilerlog.json", ec);
+        if (ec) {
+          return false;
+        }
+      }
+    }
+    return WriteManifest(dir, metrics);
+  }
+
+  int Run(int count) {
+    printf("\x1b[0;0HFARMING %d SEEDS", count);
+    std::error_code ec;
+    fs::create_directories(FARM_PATH, ec);
+    const std::vector<Filter> filters = LoadFilters();
+    printf("\x1b[1;0HFilters: %zu", filters.size());
+
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+      Settings::seed = std::to_string(rand() % 0xFFFFFFFF);
+      ClearProgress();
+      SeedMetrics metrics;
+      int ret = Playthrough::Playthrough_Init(std::hash<std::string>{}(Settings::seed), &metrics);
+      PlacementLog_Clear();
+      if (ret < 0) {
+        continue;
+      }
+
+      if (!PassesFilters(metrics, filters)) {
+        if (Settings::GenerateSpoilerLog) {
+          fs::remove(GetSpoilerLogPath(), ec);
+          fs::remove(GetJsonSpoilerLogPath(), ec);
+        }
+      } else if (Package(metrics)) {
+        kept++;
+      }
+      printf("\x1b[15;15HSeeds Generated: %d, Kept: %d\n", i + 1, kept);
+    }
+
+    return kept;
+  }
+} //namespace SeedFarm
@@ -0,0 +1,17 @@
+#pragma once
+
+//Generates many seeds in a row and keeps the ones whose playthrough matches the filters in
+///3ds/seed_farm/filters.xml, for example:
+//
+//  <seed-farm>
+//    <filter metric="spheres" min="10" max="16"/>
+//    <filter metric="barren-regions" min="4"/>
+//  </seed-farm>
+//
+//The metrics are spheres, way-of-the-hero, barren-regions and playthrough-entrances. Every kept
+//seed gets its own folder in /3ds/seed_farm/ with its spoiler log, a manifest and its patch, laid out like a
+//folder in /luma/titles/ so it can be copied over the installed one. The installed patch isn't touched.
+namespace SeedFarm {
+  //Returns how many seeds were kept
+  int Run(int count);
+} //namespace SeedFarm
@@ -300,6 +300,7 @@ namespace Settings {
   Option ChestAnimations     = Option::Bool("Chest Animations",       {"Always Fast", "Match Contents"},                                      {chestAnimDesc});
   Option ChestSize           = Option::Bool("Chest Size and Color",   {"Vanilla", "Match Contents"},                                          {chestSizeDesc});
   Option GenerateSpoilerLog  = Option::Bool("Generate Spoiler Log",   {"No", "Yes"},                                                          {""},                                                                                                             OptionCategory::Setting,    ON);
+  Option JsonSpoilerLog      = Option::Bool("  JSON Spoiler Log",     {"Off", "On"},                                                          {jsonSpoilerLogDesc},                                                                                             OptionCategory::Cosmetic);
   Option IngameSpoilers      = Option::Bool("Ingame Spoilers",        {"Hide", "Show"},                                                       {ingameSpoilersHideDesc, ingameSpoilersShowDesc });
   Option RandomTrapDmg       = Option::U8  ("Random Trap Damage",     {"Off", "Basic", "Advanced"},                                           {randomTrapDmgDesc, basicTrapDmgDesc, advancedTrapDmgDesc},                                                       OptionCategory::Setting,    RANDOMTRAPS_BASIC);
   Option FireTrap            = Option::Bool("  Fire Trap",            {"Off", "On"},                                                          {fireTrapDesc},                                                                                                   OptionCategory::Setting,    ON);
@@ -320,6 +321,7 @@ namespace Settings {
     &ChestAnimations,
     &ChestSize,
     &GenerateSpoilerLog,
+    &JsonSpoilerLog,
     &IngameSpoilers,
     &RandomTrapDmg,
     &FireTrap,
@@ -377,11 +379,13 @@ namespace Settings {
   //Item Pool Settings
   Option ItemPoolValue         = Option::U8  ("Item Pool",             {"Minimal", "Scarce", "Balanced", "Plentiful"},                        {itemPoolMinimal, itemPoolScarce, itemPoolBalanced, itemPoolPlentiful},                                           OptionCategory::Setting,    ITEMPOOL_BALANCED);
   Option IceTrapValue          = Option::U8  ("Ice Traps",             {"Off", "Normal", "Extra", "Mayhem", "Onslaught"},                     {iceTrapsOff, iceTrapsNormal, iceTrapsExtra, iceTrapsMayhem, iceTrapsOnslaught},                                  OptionCategory::Setting,    ICETRAPS_NORMAL);
+  Option IceTrapDisguises      = Option::U8  ("Ice Trap Disguises",    {"Major Items", "Item Pool", "Nearby Items"},                           {iceTrapDisguisesMajor, iceTrapDisguisesPool, iceTrapDisguisesNearby},                                            OptionCategory::Setting,    ICETRAPDISGUISES_MAJOR);
   Option RemoveDoubleDefense   = Option::Bool("Remove Double Defense", {"No", "Yes"},                                                         {removeDDDesc});
   Option ProgressiveGoronSword = Option::Bool("Prog Goron Sword",      {"Disabled", "Enabled"},                                               {progGoronSword});
   std::vector<Option *> itemPoolOptions = {
     &ItemPoolValue,
     &IceTrapValue,
+    &IceTrapDisguises,
     &RemoveDoubleDefense,
     &ProgressiveGoronSword,
   };
@@ -599,10 +603,14 @@ namespace Settings {
   Option Logic              = Option::U8  ("Logic",                   {"Glitchless", "Glitched", "No Logic", "Vanilla"}, {logicGlitchless, logicGlitched, logicNoLogic, logicVanilla});
   Option LocationsReachable = Option::Bool("All Locations Reachable", {"Off", "On"},                                     {locationsReachableDesc},                                                                                                              OptionCategory::Setting,    ON);
   Option NightGSExpectSuns  = Option::Bool("Night GSs Expect Sun's",  {"Off", "On"},                                     {nightGSDesc});
+  Option ProgressionDepth   = Option::U8  ("Progression Depth",       {"Neutral", "Later", "Much Later"},                {progressionDepthNeutral, progressionDepthLater, progressionDepthMuchLater});
+  Option ProgressionSpread  = Option::U8  ("Progression Spread",      {"Off", "Spread", "Strong"},                       {progressionSpreadOff, progressionSpreadOn, progressionSpreadStrong});
   std::vector<Option *> logicOptions = {
     &Logic,
     &LocationsReachable,
     &NightGSExpectSuns,
+    &ProgressionDepth,
+    &ProgressionSpread,
   };
 
   //Function to make defining logic tricks easier to read
@@ -898,6 +906,9 @@ namespace Settings {
   Option MP_SharedHealth   = Option::Bool("Shared Health",   {"Off", "On"},         {mp_SharedHealthDesc});
   Option MP_SharedRupees   = Option::Bool("Shared Rupees",   {"Off", "On"},         {mp_SharedRupeesDesc});
   Option MP_SharedAmmo     = Option::Bool("Shared Ammo",     {"Off", "On"},         {mp_SharedAmmoDesc});
+  Option MP_Spectator      = Option::Bool("Spectator",       {"Off", "On"},         {mp_SpectatorDesc}, OptionCategory::Cosmetic);
+  Option MW_Players        = Option::U8  ("Multiworld",      {NumOpts(1, 8, 1, "", " Player(s)")}, {mw_PlayersDesc});
+  Option MW_PlayerId       = Option::U8  ("  Player ID",     {NumOpts(1, 8)},       {mw_PlayerIdDesc}, OptionCategory::Cosmetic);
   std::vector<Option*> multiplayerOptions = {
     &MP_Enabled,
     &MP_SharedProgress,
@@ -905,6 +916,9 @@ namespace Settings {
     &MP_SharedHealth,
     &MP_SharedRupees,
     &MP_SharedAmmo,
+    &MP_Spectator,
+    &MW_Players,
+    &MW_PlayerId,
   };
 
   Option QuickText           = Option::U8  ("Quick Text",             {"0: Vanilla", "1: Skippable", "2: Instant", "3: Turbo"},               {quickTextDesc0, quickTextDesc1, quickTextDesc2, quickTextDesc3},                                                 OptionCategory::Cosmetic,   QUICKTEXT_INSTANT);
@@ -1396,6 +1410,7 @@ namespace Settings {
 
     ctx.itemPoolValue        = ItemPoolValue.Value<u8>();
     ctx.iceTrapValue         = IceTrapValue.Value<u8>();
+    ctx.iceTrapDisguises     = IceTrapDisguises.Value<u8>();
     ctx.progressiveGoronSword = (ProgressiveGoronSword) ? 1 : 0;
 
     ctx.mp_Enabled           = MP_Enabled.Value<u8>();
@@ -1404,6 +1419,9 @@ namespace Settings {
     ctx.mp_SharedAmmo        = (MP_SharedAmmo) ? 1 : 0;
     ctx.mp_SharedHealth      = (MP_SharedHealth) ? 1 : 0;
     ctx.mp_SharedRupees      = (MP_SharedRupees) ? 1 : 0;
+    ctx.mp_Spectator         = (MP_Spectator) ? 1 : 0;
+    ctx.mw_Players           = MW_Players.Value<u8>() + 1;
+    ctx.mw_PlayerId          = MW_PlayerId.Value<u8>() + 1;
 
     ctx.zTargeting           = ZTargeting.Value<u8>();
     ctx.cameraControl        = CameraControl.Value<u8>();
@@ -2018,6 +2036,13 @@ namespace Settings {
       HintDistribution.Unhide();
     }
 
+    //The JSON spoiler log is written alongside the XML one
+    if (GenerateSpoilerLog) {
+      JsonSpoilerLog.Unhide();
+    } else {
+      JsonSpoilerLog.Hide();
+    }
+
     //Only show advanced trap options if random trap damage is set to "Advanced"
     if (RandomTrapDmg.Is(RANDOMTRAPS_ADVANCED)) {
       FireTrap.Unhide();
@@ -2170,6 +2195,18 @@ namespace Settings {
         op->SetSelectedIndex(0);
       }
     }
+    //Every player has their own world in a multiworld, so there's no progress to share
+    if (MW_Players.Value<u8>() > 0) {
+      MP_SharedProgress.Hide();
+      MP_SharedProgress.SetSelectedIndex(0);
+      MW_PlayerId.Unhide();
+      if (MW_PlayerId.Value<u8>() > MW_Players.Value<u8>()) {
+        MW_PlayerId.SetSelectedIndex(MW_Players.Value<u8>());
+      }
+    } else {
+      MW_PlayerId.Hide();
+      MW_PlayerId.SetSelectedIndex(0);
+    }
     if (MP_SharedProgress) {
       MP_SyncId.Unhide();
     } else {
@@ -387,6 +387,7 @@ namespace Settings {
   extern Option ChestAnimations;
   extern Option ChestSize;
   extern Option GenerateSpoilerLog;
+  extern Option JsonSpoilerLog;
   extern Option IngameSpoilers;
   extern Option MenuOpeningButton;
   extern Option ArrowSwitchButton;
@@ -420,6 +421,7 @@ namespace Settings {
 
   extern Option ItemPoolValue;
   extern Option IceTrapValue;
+  extern Option IceTrapDisguises;
   extern Option RemoveDoubleDefense;
   extern Option ProgressiveGoronSword;
 
@@ -492,6 +494,8 @@ namespace Settings {
   //Logic Settings
   extern Option Logic;
   extern Option LocationsReachable;
+  extern Option ProgressionDepth;
+  extern Option ProgressionSpread;
   extern Option NightGSExpectSuns;
 
   //Trick Settings
@@ -631,6 +635,9 @@ namespace Settings {
   extern Option MP_SharedHealth;
   extern Option MP_SharedRupees;
   extern Option MP_SharedAmmo;
+  extern Option MP_Spectator;
+  extern Option MW_Players;
+  extern Option MW_PlayerId;
 
   //Ingame Default Settings
   extern Option ZTargeting;
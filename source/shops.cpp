@@ -1,4 +1,5 @@
 #include "item_location.hpp"
+#include "item_list.hpp"
 #include "item_pool.hpp"
 #include "location_access.hpp"
 #include "random.hpp"
@@ -13,7 +14,7 @@ using namespace Settings;
 
 std::vector<ItemAndPrice> NonShopItems = {};
 
-static std::array<std::array<Text, 3>, 0xD5> trickNameTable; //Table of trick names for ice traps
+static std::map<u16, std::array<Text, 3>> trickNameTable; //Table of trick names for ice traps, by item id
 bool initTrickNames = false; //Indicates if trick ice trap names have been initialized yet
 
 //Set vanilla shop item locations before potentially shuffling
@@ -698,12 +699,22 @@ void InitTrickNames() {
 }
 
 //Generate a fake name for the ice trap based on the item it's displayed as
-Text GetIceTrapName(u8 id) {
+Text GetIceTrapName(u16 id) {
   //If the trick names table has not been initialized, do so
   if (!initTrickNames) {
     InitTrickNames();
     initTrickNames = true;
   }
+  //Items without trick names go by their real name, so the shop text always matches the model
+  if (trickNameTable.count(id) == 0) {
+    for (int key = NONE + 1; key < KEY_ENUM_MAX; key++) {
+      const Item& item = ItemTable(static_cast<ItemKey>(key));
+      if (item.GetItemID() == id && item.GetItemType() != ITEMTYPE_SHOP && item.GetItemType() != ITEMTYPE_EVENT) {
+        trickNameTable[id] = {item.GetName(), item.GetName(), item.GetName()};
+        break;
+      }
+    }
+  }
   //Randomly get the easy, medium, or hard name for the given item id
   return RandomElement(trickNameTable[id]);
 }
@@ -16,7 +16,7 @@ extern std::vector<ItemKey> GetMinVanillaShopItems(int total_replaced);
 extern int GetRandomShopPrice();
 extern s16 GetRandomScrubPrice();
 extern int GetShopsanityReplaceAmount();
-extern Text GetIceTrapName(u8 id);
+extern Text GetIceTrapName(u16 id);
 extern int GetShopIndex(LocationKey loc);
 extern int TransformShopIndex(int index);
 
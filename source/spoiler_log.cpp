@@ -4,14 +4,18 @@
 #include "item_list.hpp"
 #include "item_location.hpp"
 #include "entrance.hpp"
+#include "hints.hpp"
+#include "multiworld.hpp"
 #include "random.hpp"
 #include "settings.hpp"
 #include "trial.hpp"
+#include "woth_requirements.hpp"
 #include "tinyxml2.h"
 #include "utils.hpp"
 #include "shops.hpp"
 
 #include <3ds.h>
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -24,6 +28,9 @@
 namespace {
   std::string placementtxt;
 
+  // Version of the JSON spoiler log layout
+  constexpr int JSON_SPOILER_SCHEMA = 2;
+
   constexpr std::array<std::string_view, 32> hashIcons = {
       "Deku Stick",
       "Deku Nut",
@@ -63,6 +70,11 @@ namespace {
 static RandomizerHash randomizerHash;
 static SpoilerData spoilerData;
 
+// Returns the number of the multiworld player the item at a location is for.
+static int GetOwnerNumber(const LocationKey key) {
+  return Multiworld::GetOwner(Multiworld::OwnWorld(), key) + 1;
+}
+
 void GenerateHash() {
   for (size_t i = 0; i < randomizerHash.size(); i++) {
     const auto iconIndex = static_cast<u8>(Random(0, hashIcons.size()));
@@ -96,14 +108,211 @@ static auto GetGeneralPath() {
   return "/3ds/" + Settings::seed + " (" + GetRandomizerHashAsString() + ")";
 }
 
-static auto GetSpoilerLogPath() {
+std::string GetSpoilerLogPath() {
   return GetGeneralPath() + "-spoilerlog.xml";
 }
 
+std::string GetJsonSpoilerLogPath() {
+  return GetGeneralPath() + "-spoilerlog.json";
+}
+
 static auto GetPlacementLogPath() {
   return GetGeneralPath() + "-placementlog.xml";
 }
 
+// Fills in the item location indices sorted by key, along with where each key's indices start and how many
+// there are. Item locations with a key of -1 are left out.
+static void WriteIngameSpoilerIndex(const std::vector<s16>& keys, size_t keyCount, u16* itemLocations, u16* offsets, u16* counts) {
+  u16 offset = 0;
+  for (size_t key = 0; key < keyCount; key++) {
+    offsets[key] = offset;
+    for (size_t itemIndex = 0; itemIndex < keys.size(); itemIndex++) {
+      if (keys[itemIndex] == static_cast<s16>(key)) {
+        itemLocations[offset++] = itemIndex;
+      }
+    }
+    counts[key] = offset - offsets[key];
+  }
+}
+
+static s16 GetIngameSpoilerItemCategory(const Item& item) {
+  switch (item.GetItemType()) {
+    case ITEMTYPE_SONG:
+      return SPOILER_ITEM_CATEGORY_SONG;
+    case ITEMTYPE_SMALLKEY:
+    case ITEMTYPE_FORTRESS_SMALLKEY:
+    case ITEMTYPE_BOSSKEY:
+      return SPOILER_ITEM_CATEGORY_KEY;
+    default:
+      return item.IsMajorItem() ? SPOILER_ITEM_CATEGORY_MAJOR : -1;
+  }
+}
+
+// Fills in the places the in-game route finder goes between and the connections between them. Areas which can
+// walk to each other without a loading zone count as the same place, while one way connections like owl flights
+// and ledge drops stay as connections that are always known. Returns false if there wasn't enough space.
+static bool WriteIngameEntranceRoutes(std::unordered_map<std::string, u16>& stringOffsetMap, u32& spoilerStringOffset) {
+  //Warp songs and spawns all start from the root, so it isn't a place the player can walk through
+  auto isRoutable = [](AreaKey key) {
+    return key != NONE && key != ROOT && key != ROOT_EXITS && areaTable[key].regionName != "";
+  };
+
+  std::vector<AreaKey> areas;
+  std::unordered_map<AreaKey, size_t> areaPositions;
+  for (AreaKey key = 0; key < areaTable.size(); key++) {
+    if (isRoutable(key)) {
+      areaPositions[key] = areas.size();
+      areas.push_back(key);
+    }
+  }
+
+  //Find every area each area can walk to, then group together the ones that can walk to each other
+  std::vector<std::vector<bool>> walkable(areas.size(), std::vector<bool>(areas.size(), false));
+  for (size_t start = 0; start < areas.size(); start++) {
+    std::vector<size_t> queue = {start};
+    walkable[start][start] = true;
+    while (!queue.empty()) {
+      AreaKey key = areas[queue.back()];
+      queue.pop_back();
+      for (const Entrance& exit : areaTable[key].exits) {
+        if (exit.GetIndex() != -1 || !isRoutable(exit.GetConnectedRegionKey())) {
+          continue;
+        }
+        size_t connected = areaPositions[exit.GetConnectedRegionKey()];
+        if (!walkable[start][connected]) {
+          walkable[start][connected] = true;
+          queue.push_back(connected);
+        }
+      }
+    }
+  }
+  std::unordered_map<AreaKey, AreaKey> groups;
+  for (size_t i = 0; i < areas.size(); i++) {
+    for (size_t j = 0; j <= i; j++) {
+      if (walkable[i][j] && walkable[j][i]) {
+        groups[areas[i]] = areas[j];
+        break;
+      }
+    }
+  }
+  auto findGroup = [&groups](AreaKey key) {
+    return groups[key];
+  };
+
+  //Places are the groups with loading zones in or out of them
+  struct RouteEdge {
+    AreaKey from;
+    AreaKey to;
+    SpoilerRouteEdge data;
+  };
+  std::vector<RouteEdge> edges;
+  std::map<AreaKey, std::string> nodeNames;
+  std::map<AreaKey, std::set<AreaKey>> oneWayConnections;
+  for (AreaKey key : areas) {
+    for (const Entrance& exit : areaTable[key].exits) {
+      AreaKey from = findGroup(key);
+      AreaKey to = isRoutable(exit.GetConnectedRegionKey()) ? findGroup(exit.GetConnectedRegionKey()) : NONE;
+      if (to == NONE || from == to) {
+        continue;
+      }
+      if (exit.GetIndex() == -1) {
+        oneWayConnections[from].insert(to);
+        continue;
+      }
+      bool shuffled = exit.IsShuffled() && exit.GetReplacement() != nullptr;
+      edges.push_back({from, to, {
+        .DiscoverIndex = shuffled ? exit.GetIndex() : static_cast<s16>(-1),
+        .ArrivalIndex = shuffled ? exit.GetReplacement()->GetIndex() : exit.GetIndex(),
+        .TargetNode = 0,
+      }});
+      nodeNames[from] = "";
+      nodeNames[to] = "";
+    }
+  }
+  //Connect places that can be reached from each other without a loading zone, going through
+  //any groups in between that aren't places themselves
+  for (auto& [place, name] : nodeNames) {
+    std::set<AreaKey> visited = {place};
+    std::vector<AreaKey> queue = {place};
+    while (!queue.empty()) {
+      AreaKey group = queue.back();
+      queue.pop_back();
+      for (AreaKey connected : oneWayConnections[group]) {
+        if (!visited.insert(connected).second) {
+          continue;
+        }
+        if (nodeNames.find(connected) != nodeNames.end()) {
+          edges.push_back({place, connected, {-1, -1, 0}});
+        } else {
+          queue.push_back(connected);
+        }
+      }
+    }
+  }
+
+  //Name each place after the scene most of its areas are in, or its first area if they're all interiors
+  std::vector<std::pair<std::string, AreaKey>> nodes;
+  for (auto& [group, name] : nodeNames) {
+    std::map<std::string, int> sceneCounts;
+    for (AreaKey key : areas) {
+      if (findGroup(key) == group && areaTable[key].scene != "") {
+        sceneCounts[areaTable[key].scene]++;
+      }
+    }
+    name = areaTable[group].regionName;
+    int mostAreas = 0;
+    for (auto& [scene, count] : sceneCounts) {
+      if (count > mostAreas) {
+        name = scene;
+        mostAreas = count;
+      }
+    }
+    nodes.push_back({name, group});
+  }
+  //Places split up by one way connections would share their scene's name, so tell them apart by their first area
+  std::map<std::string, int> nameCounts;
+  for (auto& node : nodes) {
+    nameCounts[node.first]++;
+  }
+  for (auto& node : nodes) {
+    if (nameCounts[node.first] > 1) {
+      node.first = areaTable[node.second].regionName;
+    }
+  }
+  std::sort(nodes.begin(), nodes.end());
+  if (nodes.size() > SPOILER_ROUTE_NODES_MAX || edges.size() > SPOILER_ROUTE_EDGES_MAX) {
+    return false;
+  }
+
+  std::map<AreaKey, u16> nodeIndices;
+  for (u16 i = 0; i < nodes.size(); i++) {
+    const std::string& name = nodes[i].first;
+    if (stringOffsetMap.find(name) == stringOffsetMap.end()) {
+      if (spoilerStringOffset + name.size() + 1 >= SPOILER_STRING_DATA_SIZE) {
+        return false;
+      }
+      stringOffsetMap[name] = spoilerStringOffset;
+      spoilerStringOffset += sprintf(&spoilerData.StringData[spoilerStringOffset], "%.51s", name.c_str()) + 1;
+    }
+    spoilerData.RouteNodeNameOffsets[i] = stringOffsetMap[name];
+    nodeIndices[nodes[i].second] = i;
+  }
+
+  u16 edgeCount = 0;
+  for (u16 i = 0; i < nodes.size(); i++) {
+    spoilerData.RouteNodeEdgeOffsets[i] = edgeCount;
+    for (RouteEdge& edge : edges) {
+      if (edge.from == nodes[i].second) {
+        edge.data.TargetNode = nodeIndices[edge.to];
+        spoilerData.RouteEdges[edgeCount++] = edge.data;
+      }
+    }
+  }
+  spoilerData.RouteNodeEdgeOffsets[nodes.size()] = edgeCount;
+  spoilerData.RouteNodeCount = nodes.size();
+  return true;
+}
+
 void WriteIngameSpoilerLog() {
   u16 spoilerItemIndex = 0;
   u32 spoilerStringOffset = 0;
@@ -119,6 +328,7 @@ void WriteIngameSpoilerLog() {
   itemLocationsMap.reserve(allLocations.size());
   std::unordered_map<std::string, u16> stringOffsetMap; // Map of strings to their offset into spoiler string data array
   stringOffsetMap.reserve(allLocations.size() * 2);
+  std::vector<LocationKey> trackedLocations; // Locations in the order they were added to the spoiler data item locations
 
   // Sort all locations by their group, so the in-game log can show a group of items by simply starting/ending at certain indices
   std::stable_sort(allLocations.begin(), allLocations.end(), [](const LocationKey &a, const LocationKey &b) {
@@ -178,6 +388,9 @@ void WriteIngameSpoilerLog() {
     if (loc->GetPlacedItemKey() == ICE_TRAP && loc->IsCategory(Category::cShop)) {
         locItem = NonShopItems[TransformShopIndex(GetShopIndex(key))].Name.GetNAEnglish();
     }
+    if (Multiworld::IsForeign(key)) {
+        locItem += " (P" + std::to_string(GetOwnerNumber(key)) + ")";
+    }
     if (stringOffsetMap.find(locItem) == stringOffsetMap.end()) {
       if (spoilerStringOffset + locItem.size() + 1 >= SPOILER_STRING_DATA_SIZE) {
         spoilerOutOfSpace = true;
@@ -242,9 +455,11 @@ void WriteIngameSpoilerLog() {
     ++spoilerGroupOffset;
 
     itemLocationsMap[key] = spoilerItemIndex++;
+    trackedLocations.push_back(key);
   }
   spoilerData.ItemLocationsCount = spoilerItemIndex;
 
+  // The playthrough only needs the item locations, so it's written before the lists that fill up the string data
   if (Settings::IngameSpoilers) {
     bool playthroughItemNotFound = false;
     // Write playthrough data to in-game spoiler log
@@ -274,6 +489,87 @@ void WriteIngameSpoilerLog() {
     }
     if (spoilerOutOfSpace || playthroughItemNotFound) { printf("%sError!%s ", YELLOW, WHITE); }
   }
+
+  // Sort the tracked locations by hint region, item category and scene for the in-game tracker filters.
+  // Use the hint regions from before entrances were shuffled, or the filter would give away where they lead.
+  std::vector<s16> hintRegions, categories, scenes;
+  std::map<HintKey, s16> hintRegionIndices;
+  for (const LocationKey key : trackedLocations) {
+    auto loc = Location(key);
+
+    HintKey hintRegion = GetLocationRegionHintKey(key, true);
+    if (hintRegionIndices.find(hintRegion) == hintRegionIndices.end()) {
+      std::string regionName = hintRegion != NONE ? Hint(hintRegion).GetClearOrFirstObscure().GetNAEnglish() : "Other";
+      regionName.erase(std::remove(regionName.begin(), regionName.end(), '#'), regionName.end());
+      // Locations in a region that doesn't fit are left out of the hint region filter
+      if (spoilerData.HintRegionCount >= SPOILER_HINT_REGIONS_MAX ||
+          (stringOffsetMap.find(regionName) == stringOffsetMap.end() && spoilerStringOffset + regionName.size() + 1 >= SPOILER_STRING_DATA_SIZE)) {
+        spoilerData.TruncatedSections |= SPOILER_TRUNCATED_HINT_REGIONS;
+        hintRegionIndices[hintRegion] = -1;
+      } else {
+        if (stringOffsetMap.find(regionName) == stringOffsetMap.end()) {
+          stringOffsetMap[regionName] = spoilerStringOffset;
+          spoilerStringOffset += sprintf(&spoilerData.StringData[spoilerStringOffset], "%.51s", regionName.c_str()) + 1;
+        }
+        spoilerData.HintRegionNameOffsets[spoilerData.HintRegionCount] = stringOffsetMap[regionName];
+        hintRegionIndices[hintRegion] = spoilerData.HintRegionCount++;
+      }
+    }
+    hintRegions.push_back(hintRegionIndices[hintRegion]);
+
+    categories.push_back(GetIngameSpoilerItemCategory(loc->GetPlacedItem()));
+    scenes.push_back(loc->GetScene() < SPOILER_SCENES_MAX ? loc->GetScene() : -1);
+  }
+  WriteIngameSpoilerIndex(hintRegions, spoilerData.HintRegionCount, spoilerData.HintRegionItemLocations,
+                          spoilerData.HintRegionOffsets, spoilerData.HintRegionItemCounts);
+  WriteIngameSpoilerIndex(categories, SPOILER_ITEM_CATEGORY_COUNT, spoilerData.CategoryItemLocations,
+                          spoilerData.CategoryOffsets, spoilerData.CategoryItemCounts);
+  WriteIngameSpoilerIndex(scenes, SPOILER_SCENES_MAX, spoilerData.SceneItemLocations,
+                          spoilerData.SceneOffsets, spoilerData.SceneItemCounts);
+
+  // Item location of each override, in the same order as the override table in the patch,
+  // so the patch can mark a location collected from the key of the item it just gave
+  std::fill(std::begin(spoilerData.OverrideItemLocations), std::end(spoilerData.OverrideItemLocations), SPOILER_NO_ITEM_LOCATION);
+  std::unordered_map<u32, u16> overrideIndices;
+  overrideIndices.reserve(overrides.size());
+  for (const ItemOverride& override : overrides) {
+    const u16 overrideIndex = overrideIndices.size();
+    overrideIndices.emplace(override.key.all, overrideIndex);
+  }
+  for (const LocationKey key : trackedLocations) {
+    auto it = overrideIndices.find(Location(key)->Key().all);
+    if (it != overrideIndices.end() && it->second < ITEM_OVERRIDES_MAX) {
+      spoilerData.OverrideItemLocations[it->second] = itemLocationsMap[key];
+    }
+  }
+
+  // Gossip stones with a hint placed on them, for the in-game hint log
+  for (const LocationKey key : gossipStoneLocations) {
+    auto loc = Location(key);
+    if (loc->GetPlacedItemKey() != key) {
+      continue;
+    }
+
+    auto stoneName = loc->GetName();
+    if (spoilerData.HintCount >= SPOILER_HINTS_MAX ||
+        (stringOffsetMap.find(stoneName) == stringOffsetMap.end() && spoilerStringOffset + stoneName.size() + 1 >= SPOILER_STRING_DATA_SIZE)) {
+      spoilerData.TruncatedSections |= SPOILER_TRUNCATED_HINTS;
+      break;
+    }
+    if (stringOffsetMap.find(stoneName) == stringOffsetMap.end()) {
+      stringOffsetMap[stoneName] = spoilerStringOffset;
+      spoilerStringOffset += sprintf(&spoilerData.StringData[spoilerStringOffset], "%.51s", stoneName.c_str()) + 1;
+    }
+    spoilerData.Hints[spoilerData.HintCount].StoneStrOffset = stringOffsetMap[stoneName];
+    // Same message ID as AddHint gives the stone's hint
+    spoilerData.Hints[spoilerData.HintCount].MessageId = 0x400 + loc->GetFlag();
+    ++spoilerData.HintCount;
+  }
+
+  // Only entrance shuffle needs the route finder. The routes are left out if they don't fit
+  if (!entranceOverrides.empty() && !WriteIngameEntranceRoutes(stringOffsetMap, spoilerStringOffset)) {
+    spoilerData.TruncatedSections |= SPOILER_TRUNCATED_ROUTES;
+  }
 }
 
 // Writes the location to the specified node.
@@ -287,6 +583,9 @@ static void WriteLocation(
   auto node = parentNode->InsertNewChildElement("location");
   node->SetAttribute("name", location->GetName().c_str());
   node->SetText(location->GetPlacedItemName().GetNAEnglish().c_str());
+  if (Multiworld::IsForeign(locationKey)) {
+    node->SetAttribute("player", GetOwnerNumber(locationKey));
+  }
 
   if (withPadding) {
     constexpr int16_t LONGEST_NAME = 56; // The longest name of a location.
@@ -339,24 +638,32 @@ static void WriteShuffledEntrance(
   }
 }
 
-// Writes the settings (without excluded locations, starting inventory and tricks) to the spoilerLog document.
-static void WriteSettings(tinyxml2::XMLDocument& spoilerLog, const bool printAll = false) {
-  auto parentNode = spoilerLog.NewElement("settings");
-
-  std::vector<Menu*> allMenus = Settings::GetAllOptionMenus();
+// Returns the settings that are listed in the spoiler log, in menu order.
+static std::vector<const Option*> GetSpoilerSettings(const bool printAll) {
+  std::vector<const Option*> settings = {};
 
-  for (const Menu* menu : allMenus) {
-    //This is a menu of settings, write them
+  for (const Menu* menu : Settings::GetAllOptionMenus()) {
+    //This is a menu of settings, list them
     if (menu->mode == OPTION_MENU && menu->printInSpoiler) {
       for (const Option* setting : *menu->settingsList) {
         if (printAll || (!setting->IsHidden() && setting->IsCategory(OptionCategory::Setting))) {
-          auto node = parentNode->InsertNewChildElement("setting");
-          node->SetAttribute("name", RemoveLineBreaks(setting->GetName()).c_str());
-          node->SetText(setting->GetSelectedOptionText().c_str());
+          settings.push_back(setting);
         }
       }
     }
   }
+  return settings;
+}
+
+// Writes the settings (without excluded locations, starting inventory and tricks) to the spoilerLog document.
+static void WriteSettings(tinyxml2::XMLDocument& spoilerLog, const bool printAll = false) {
+  auto parentNode = spoilerLog.NewElement("settings");
+
+  for (const Option* setting : GetSpoilerSettings(printAll)) {
+    auto node = parentNode->InsertNewChildElement("setting");
+    node->SetAttribute("name", RemoveLineBreaks(setting->GetName()).c_str());
+    node->SetText(setting->GetSelectedOptionText().c_str());
+  }
   spoilerLog.RootElement()->InsertEndChild(parentNode);
 }
 
@@ -511,7 +818,7 @@ static void WritePlaythrough(tinyxml2::XMLDocument& spoilerLog) {
   spoilerLog.RootElement()->InsertEndChild(playthroughNode);
 }
 
-//Write the randomized entrance playthrough to the spoiler log, if applicable
+//Write the randomized entrance playthrough and every shuffled entrance to the spoiler log, if applicable
 static void WriteShuffledEntrances(tinyxml2::XMLDocument& spoilerLog) {
   if (!Settings::ShuffleEntrances || noRandomEntrances) {
     return;
@@ -529,6 +836,15 @@ static void WriteShuffledEntrances(tinyxml2::XMLDocument& spoilerLog) {
   }
 
   spoilerLog.RootElement()->InsertEndChild(playthroughNode);
+
+  //The playthrough only has the entrances needed to beat the game
+  auto allEntrancesNode = spoilerLog.NewElement("all-entrances");
+  for (Entrance* entrance : GetShuffleableEntrances(EntranceType::All, false)) {
+    if (entrance->IsShuffled()) {
+      WriteShuffledEntrance(allEntrancesNode, entrance, true);
+    }
+  }
+  spoilerLog.RootElement()->InsertEndChild(allEntrancesNode);
 }
 
 // Writes the WOTH locations to the spoiler log, if there are any.
@@ -537,6 +853,34 @@ static void WriteWayOfTheHeroLocation(tinyxml2::XMLDocument& spoilerLog) {
 
   for (const LocationKey key : wothLocations) {
     WriteLocation(parentNode, key, true);
+
+    //List the exits and locations that can't be opened without this item
+    std::string requiredFor = "";
+    for (const std::string& name : WothRequirements::RequiredFor(key)) {
+      requiredFor += (requiredFor.empty() ? "" : ", ") + name;
+    }
+    if (!requiredFor.empty()) {
+      parentNode->LastChildElement()->SetAttribute("required-for", requiredFor.c_str());
+    }
+  }
+
+  if (!parentNode->NoChildren()) {
+    spoilerLog.RootElement()->InsertEndChild(parentNode);
+  }
+}
+
+static std::string GetBarrenRegionName(const HintKey region) {
+  std::string regionName = region != NONE ? Hint(region).GetClearOrFirstObscure().GetNAEnglish() : "Other";
+  regionName.erase(std::remove(regionName.begin(), regionName.end(), '#'), regionName.end());
+  return regionName;
+}
+
+static void WriteBarrenRegions(tinyxml2::XMLDocument& spoilerLog) {
+  auto parentNode = spoilerLog.NewElement("barren-regions");
+
+  for (const HintKey region : GetBarrenRegions()) {
+    auto node = parentNode->InsertNewChildElement("region");
+    node->SetText(GetBarrenRegionName(region).c_str());
   }
 
   if (!parentNode->NoChildren()) {
@@ -544,6 +888,14 @@ static void WriteWayOfTheHeroLocation(tinyxml2::XMLDocument& spoilerLog) {
   }
 }
 
+// Returns a gossip stone's hint without the message box control characters.
+static std::string GetHintText(const LocationKey key) {
+  auto text = Location(key)->GetPlacedItemName().GetNAEnglish();
+  std::replace(text.begin(), text.end(), '&', ' ');
+  std::replace(text.begin(), text.end(), '^', ' ');
+  return text;
+}
+
 // Writes the hints to the spoiler log, if they are enabled.
 static void WriteHints(tinyxml2::XMLDocument& spoilerLog) {
   if (Settings::GossipStoneHints.Is(HINTS_NO_HINTS)) {
@@ -553,15 +905,9 @@ static void WriteHints(tinyxml2::XMLDocument& spoilerLog) {
   auto parentNode = spoilerLog.NewElement("hints");
 
   for (const LocationKey key : gossipStoneLocations) {
-    ItemLocation* location = Location(key);
-
     auto node = parentNode->InsertNewChildElement("hint");
-    node->SetAttribute("location", location->GetName().c_str());
-
-    auto text = location->GetPlacedItemName().GetNAEnglish();
-    std::replace(text.begin(), text.end(), '&', ' ');
-    std::replace(text.begin(), text.end(), '^', ' ');
-    node->SetText(text.c_str());
+    node->SetAttribute("location", Location(key)->GetName().c_str());
+    node->SetText(GetHintText(key).c_str());
   }
 
   spoilerLog.RootElement()->InsertEndChild(parentNode);
@@ -579,6 +925,142 @@ static void WriteAllLocations(tinyxml2::XMLDocument& spoilerLog) {
   spoilerLog.RootElement()->InsertEndChild(parentNode);
 }
 
+// Quotes and escapes a string for the JSON spoiler log.
+static std::string JsonString(std::string_view text) {
+  std::string quoted = "\"";
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (c == '\n') {
+      quoted += "\\n";
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[7];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04X", static_cast<unsigned char>(c));
+      quoted += escaped;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + "\"";
+}
+
+static void JsonWrite(FILE* file, std::string_view text) {
+  fwrite(text.data(), 1, text.size(), file);
+}
+
+// Writes the compact JSON version of the spoiler log, for trackers and other tools. Locations,
+// entrances and gossip stones are keyed by the same names as in the XML log, and the spheres and
+// way of the hero list location names. Bump JSON_SPOILER_SCHEMA when the layout changes.
+// Has to be called before the playthrough and way of the hero are cleared.
+static bool WriteJsonSpoilerLog() {
+  FILE* file = fopen(GetJsonSpoilerLogPath().c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  //Written a piece at a time, so the whole document is never held in memory
+  JsonWrite(file, "{\"schema\":" + std::to_string(JSON_SPOILER_SCHEMA));
+  JsonWrite(file, ",\"version\":" + JsonString(Settings::version));
+  JsonWrite(file, ",\"seed\":" + JsonString(Settings::seed));
+
+  JsonWrite(file, ",\"hash\":[");
+  for (size_t i = 0; i < randomizerHash.size(); i++) {
+    JsonWrite(file, (i > 0 ? "," : "") + JsonString(randomizerHash[i]));
+  }
+
+  JsonWrite(file, "],\"settings\":{");
+  bool first = true;
+  for (const Option* setting : GetSpoilerSettings(false)) {
+    JsonWrite(file, (first ? "" : ",") + JsonString(RemoveLineBreaks(setting->GetName())) + ":" + JsonString(setting->GetSelectedOptionText()));
+    first = false;
+  }
+
+  //Each location with its item, shop items also have their price
+  JsonWrite(file, "},\"locations\":{");
+  first = true;
+  for (const LocationKey key : allLocations) {
+    const ItemLocation* location = Location(key);
+    if (location->IsHidden()) {
+      continue;
+    }
+    std::string entry = (first ? "" : ",") + JsonString(location->GetName());
+    entry += ":{\"item\":" + JsonString(location->GetPlacedItemName().GetNAEnglish());
+    if (Multiworld::IsForeign(key)) {
+      entry += ",\"player\":" + std::to_string(GetOwnerNumber(key));
+    }
+    if (location->IsCategory(Category::cShop)) {
+      entry += ",\"price\":" + std::to_string(location->GetPrice());
+    }
+    JsonWrite(file, entry + "}");
+    first = false;
+  }
+
+  //Sphere i is at index i - 1. Like in the XML log, the spheres also have locations that aren't listed above
+  JsonWrite(file, "},\"spheres\":[");
+  for (size_t i = 0; i < playthroughLocations.size(); i++) {
+    JsonWrite(file, i > 0 ? ",{" : "{");
+    for (auto it = playthroughLocations[i].begin(); it != playthroughLocations[i].end(); ++it) {
+      const ItemLocation* location = Location(*it);
+      JsonWrite(file, (it != playthroughLocations[i].begin() ? "," : "") + JsonString(location->GetName()) + ":" + JsonString(location->GetPlacedItemName().GetNAEnglish()));
+    }
+    JsonWrite(file, "}");
+  }
+
+  JsonWrite(file, "],\"way-of-the-hero\":{");
+  for (size_t i = 0; i < wothLocations.size(); i++) {
+    const ItemLocation* location = Location(wothLocations[i]);
+    JsonWrite(file, (i > 0 ? "," : "") + JsonString(location->GetName()) + ":" + JsonString(location->GetPlacedItemName().GetNAEnglish()));
+  }
+
+  JsonWrite(file, "},\"barren-regions\":[");
+  first = true;
+  for (const HintKey region : GetBarrenRegions()) {
+    JsonWrite(file, (first ? "" : ",") + JsonString(GetBarrenRegionName(region)));
+    first = false;
+  }
+
+  //Every shuffled entrance with where it leads, and the ones needed to beat the game grouped by sphere
+  JsonWrite(file, "],\"entrances\":{");
+  const bool entrancesShuffled = Settings::ShuffleEntrances && !noRandomEntrances;
+  if (entrancesShuffled) {
+    first = true;
+    for (const Entrance* entrance : GetShuffleableEntrances(EntranceType::All, false)) {
+      if (!entrance->IsShuffled()) {
+        continue;
+      }
+      const std::string target = entrance->GetConnectedRegion()->regionName + " from " + entrance->GetReplacement()->GetParentRegion()->regionName;
+      JsonWrite(file, (first ? "" : ",") + JsonString(entrance->GetName()) + ":" + JsonString(target));
+      first = false;
+    }
+  }
+  JsonWrite(file, "},\"entrance-spheres\":[");
+  if (entrancesShuffled) {
+    //Each sphere lists the names of the entrances, where they lead is in the list above
+    for (size_t i = 0; i < playthroughEntrances.size(); i++) {
+      JsonWrite(file, i > 0 ? ",[" : "[");
+      first = true;
+      for (const Entrance* entrance : playthroughEntrances[i]) {
+        JsonWrite(file, (first ? "" : ",") + JsonString(entrance->GetName()));
+        first = false;
+      }
+      JsonWrite(file, "]");
+    }
+  }
+
+  JsonWrite(file, "],\"hints\":{");
+  if (!Settings::GossipStoneHints.Is(HINTS_NO_HINTS)) {
+    for (size_t i = 0; i < gossipStoneLocations.size(); i++) {
+      const LocationKey key = gossipStoneLocations[i];
+      JsonWrite(file, (i > 0 ? "," : "") + JsonString(Location(key)->GetName()) + ":" + JsonString(GetHintText(key)));
+    }
+  }
+  JsonWrite(file, "}}\n");
+
+  const bool written = !ferror(file);
+  return fclose(file) == 0 && written;
+}
+
 bool SpoilerLog_Write() {
   auto spoilerLog = tinyxml2::XMLDocument(false);
   spoilerLog.InsertEndChild(spoilerLog.NewDeclaration());
@@ -601,17 +1083,21 @@ bool SpoilerLog_Write() {
   WriteRequiredTrials(spoilerLog);
   WritePlaythrough(spoilerLog);
   WriteWayOfTheHeroLocation(spoilerLog);
+  WriteBarrenRegions(spoilerLog);
+
+  const bool jsonWritten = !Settings::JsonSpoilerLog || WriteJsonSpoilerLog();
 
   playthroughLocations.clear();
   playthroughBeatable = false;
   wothLocations.clear();
+  WothRequirements::Clear();
 
   WriteHints(spoilerLog);
   WriteShuffledEntrances(spoilerLog);
   WriteAllLocations(spoilerLog);
 
   auto e = spoilerLog.SaveFile(GetSpoilerLogPath().c_str());
-  return e == tinyxml2::XML_SUCCESS;
+  return e == tinyxml2::XML_SUCCESS && jsonWritten;
 }
 
 void PlacementLog_Msg(std::string_view msg) {
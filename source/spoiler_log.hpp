@@ -9,10 +9,13 @@ using RandomizerHash = std::array<std::string, 5>;
 
 void GenerateHash();
 const RandomizerHash& GetRandomizerHash();
+const std::string GetRandomizerHashAsString();
 
 void WriteIngameSpoilerLog();
 
 bool SpoilerLog_Write();
+std::string GetSpoilerLogPath();
+std::string GetJsonSpoilerLogPath();
 const SpoilerData& GetSpoilerData();
 
 void PlacementLog_Msg(std::string_view msg);
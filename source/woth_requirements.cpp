@@ -0,0 +1,105 @@
+#include "woth_requirements.hpp"
+
+#include "entrance.hpp"
+#include "item_location.hpp"
+#include "location_access.hpp"
+
+#include <map>
+
+namespace WothRequirements {
+
+  //An exit or item location, whichever one isn't used is nullptr
+  struct Edge {
+    Area* parent;
+    const Entrance* exit;
+    const LocationAccess* location;
+  };
+
+  //Which ages and times of day each edge's area was reached at, and which of those its condition was met at
+  struct EdgeAccess {
+    std::vector<u8> reached;
+    std::vector<u8> passed;
+  };
+
+  static std::map<LocationKey, EdgeAccess> accessWithout;
+  static std::map<LocationKey, std::vector<std::string>> requiredFor;
+
+  //Every exit and location of every area, always in the same order so the edges of different searches line up
+  static std::vector<Edge> CollectEdges() {
+    std::vector<Edge> edges = {};
+    for (Area& area : areaTable) {
+      for (const Entrance& exit : area.exits) {
+        edges.push_back({&area, &exit, nullptr});
+      }
+      for (const LocationAccess& locPair : area.locations) {
+        edges.push_back({&area, nullptr, &locPair});
+      }
+    }
+    return edges;
+  }
+
+  //Checks each edge at the ages and times of day its area was reached at by the last search.
+  //The ages and times of day are the outer loop so the logic helpers only have to be updated
+  //once for each of them, instead of once for every condition.
+  static EdgeAccess CheckEdges(const std::vector<Edge>& edges) {
+    EdgeAccess access;
+    access.reached.resize(edges.size());
+    access.passed.assign(edges.size(), 0);
+    for (size_t i = 0; i < edges.size(); i++) {
+      access.reached[i] = edges[i].parent->ageTimeAccess;
+    }
+    for (u8 ageTime = AGETIME_CHILD_DAY; ageTime <= AGETIME_ADULT_NIGHT; ageTime <<= 1) {
+      Areas::SetLogicAgeTime(ageTime);
+      for (size_t i = 0; i < edges.size(); i++) {
+        const Edge& edge = edges[i];
+        if (!(access.reached[i] & ageTime)) {
+          continue;
+        }
+        bool conditionsMet = edge.exit != nullptr ? edge.exit->GetConditionsMet() && edge.exit->GetConnectedRegionKey() != NONE
+                                                  : edge.location->GetConditionsMet() && edge.location->CanBuy();
+        if (conditionsMet) {
+          access.passed[i] |= ageTime;
+        }
+      }
+    }
+    return access;
+  }
+
+  static std::string GetEdgeName(const Edge& edge) {
+    if (edge.exit != nullptr) {
+      return edge.exit->GetName() != "" ? edge.exit->GetName() : edge.exit->to_string();
+    }
+    return Location(edge.location->GetLocation())->GetName();
+  }
+
+  void RecordWithout(LocationKey loc) {
+    accessWithout[loc] = CheckEdges(CollectEdges());
+  }
+
+  void Build() {
+    requiredFor.clear();
+    const std::vector<Edge> edges = CollectEdges();
+    const EdgeAccess withAllItems = CheckEdges(edges);
+
+    for (const auto& [loc, withoutItem] : accessWithout) {
+      std::vector<std::string>& names = requiredFor[loc];
+      for (size_t i = 0; i < edges.size(); i++) {
+        if (withAllItems.passed[i] & withoutItem.reached[i] & ~withoutItem.passed[i]) {
+          names.push_back(GetEdgeName(edges[i]));
+        }
+      }
+    }
+    accessWithout.clear();
+  }
+
+  const std::vector<std::string>& RequiredFor(LocationKey loc) {
+    static const std::vector<std::string> none = {};
+    auto it = requiredFor.find(loc);
+    return it != requiredFor.end() ? it->second : none;
+  }
+
+  void Clear() {
+    accessWithout.clear();
+    requiredFor.clear();
+  }
+} //namespace WothRequirements
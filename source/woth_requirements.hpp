@@ -0,0 +1,23 @@
+#pragma once
+
+#include <3ds.h>
+
+#include "keys.hpp"
+
+#include <string>
+#include <vector>
+
+//Lists what each Way of the Hero item is needed for, for the spoiler log. The search
+//that shows an item is required also shows where the world stops without it: every
+//exit or location whose area that search reached, but which it couldn't open at an
+//age or time of day the full world can, needs the item.
+namespace WothRequirements {
+  //Must be called right after the search that found the game can't be beaten without
+  //the item at the given location, since it works from the items and access that search found
+  void RecordWithout(LocationKey loc);
+  //Must be called right after a search with every item collected
+  void Build();
+  //Names of the exits and item locations which need the item at the location
+  const std::vector<std::string>& RequiredFor(LocationKey loc);
+  void Clear();
+} //namespace WothRequirements
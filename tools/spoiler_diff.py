@@ -0,0 +1,157 @@
+import argparse
+import json
+import os
+import sys
+import xml.etree.ElementTree as ET
+from multiprocessing import Pool
+
+# Compares two spoiler logs, or two folders of spoiler logs paired by seed, and prints what changed:
+# settings, item placements, playthrough spheres, way of the hero and barren regions, entrances and hints.
+# Usage: python3 tools/spoiler_diff.py old new [--json]
+
+
+def ReadSpoilerLog(path):
+    root = ET.parse(path).getroot()
+    log = {
+        "seed": root.get("seed", ""),
+        "settings": {},
+        "placements": {},
+        "spheres": {},
+        "woth": set(),
+        "barren": set(),
+        "entrances": {},
+        "hints": {},
+    }
+
+    for setting in root.iterfind("settings/setting"):
+        log["settings"][setting.get("name").strip()] = setting.text or ""
+    for location in root.iterfind("all-locations/location"):
+        log["placements"][location.get("name")] = location.text or ""
+    for sphere in root.iterfind("playthrough/sphere"):
+        for location in sphere.iterfind("location"):
+            log["spheres"][location.get("name")] = int(sphere.get("level"))
+    for location in root.iterfind("way-of-the-hero-locations/location"):
+        log["woth"].add(location.get("name"))
+    for region in root.iterfind("barren-regions/region"):
+        log["barren"].add(region.text or "")
+    # Logs from before the full entrance list only have the entrances in the entrance playthrough
+    entrances = root.find("all-entrances")
+    for entrance in root.iterfind("all-entrances/entrance" if entrances is not None else "entrance-playthrough/sphere/entrance"):
+        log["entrances"][entrance.get("name")] = entrance.text or ""
+    for hint in root.iterfind("hints/hint"):
+        log["hints"][hint.get("location")] = hint.text or ""
+    return log
+
+
+# Returns [key, old, new] for every key whose value differs, None meaning the key is missing on that side
+def DiffMaps(old, new):
+    return [[key, old.get(key), new.get(key)] for key in sorted(old.keys() | new.keys()) if old.get(key) != new.get(key)]
+
+
+def DiffSets(old, new):
+    return {"removed": sorted(old - new), "added": sorted(new - old)}
+
+
+def DiffLogs(paths):
+    oldPath, newPath = paths
+    old = ReadSpoilerLog(oldPath)
+    new = ReadSpoilerLog(newPath)
+
+    # A sphere move only counts when the item is the same, otherwise it's already a placement change
+    sphereMoves = [entry for entry in DiffMaps(old["spheres"], new["spheres"])
+                   if old["placements"].get(entry[0]) == new["placements"].get(entry[0])]
+
+    diff = {
+        "old": oldPath,
+        "new": newPath,
+        "settings": DiffMaps(old["settings"], new["settings"]),
+        "placements": DiffMaps(old["placements"], new["placements"]),
+        "spheres": sphereMoves,
+        "woth": DiffSets(old["woth"], new["woth"]),
+        "barren": DiffSets(old["barren"], new["barren"]),
+        "entrances": DiffMaps(old["entrances"], new["entrances"]),
+        "hints": DiffMaps(old["hints"], new["hints"]),
+    }
+    diff["changed"] = any(diff[section] for section in ("settings", "placements", "spheres", "entrances", "hints")) or \
+                      any(diff[section]["removed"] or diff[section]["added"] for section in ("woth", "barren"))
+    return diff
+
+
+# The seed is an attribute of the root element, so only the start of each log has to be read to find it
+def ReadSeed(path, default):
+    for _, root in ET.iterparse(path, events=("start",)):
+        return root.get("seed", default)
+    return default
+
+
+# Folders are matched up by the seed in each log, so the file names (which include the hash) can differ
+def PairLogs(oldDir, newDir):
+    def LogsBySeed(folder):
+        logs = {}
+        for name in sorted(os.listdir(folder)):
+            if name.endswith("-spoilerlog.xml"):
+                path = os.path.join(folder, name)
+                logs[ReadSeed(path, name)] = path
+        return logs
+
+    oldLogs = LogsBySeed(oldDir)
+    newLogs = LogsBySeed(newDir)
+    unmatched = sorted(oldLogs.keys() ^ newLogs.keys())
+    pairs = [(oldLogs[seed], newLogs[seed]) for seed in sorted(oldLogs.keys() & newLogs.keys())]
+    return pairs, unmatched
+
+
+def FormatValue(value):
+    return "(none)" if value is None else value
+
+
+def PrintDiff(diff):
+    print("--- " + diff["old"])
+    print("+++ " + diff["new"])
+    for section in ("settings", "placements", "entrances", "hints"):
+        for key, old, new in diff[section]:
+            print("  {} | {}: {} -> {}".format(section, key, FormatValue(old), FormatValue(new)))
+    for key, old, new in diff["spheres"]:
+        print("  spheres | {}: {} -> {}".format(key, FormatValue(old), FormatValue(new)))
+    for section in ("woth", "barren"):
+        for key in diff[section]["removed"]:
+            print("  {} | -{}".format(section, key))
+        for key in diff[section]["added"]:
+            print("  {} | +{}".format(section, key))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare spoiler logs")
+    parser.add_argument("old", help="spoiler log, or folder of spoiler logs")
+    parser.add_argument("new", help="spoiler log, or folder of spoiler logs")
+    parser.add_argument("--json", action="store_true", help="print the differences as JSON")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="number of logs compared at the same time")
+    args = parser.parse_args()
+
+    if os.path.isdir(args.old) and os.path.isdir(args.new):
+        pairs, unmatched = PairLogs(args.old, args.new)
+    else:
+        pairs, unmatched = [(args.old, args.new)], []
+
+    if len(pairs) > 1:
+        with Pool(args.jobs) as pool:
+            diffs = pool.map(DiffLogs, pairs, chunksize=16)
+    else:
+        diffs = [DiffLogs(pair) for pair in pairs]
+    changed = [diff for diff in diffs if diff["changed"]]
+
+    if args.json:
+        json.dump({"compared": len(diffs), "unmatched-seeds": unmatched, "diffs": changed}, sys.stdout, indent=2)
+        print()
+    else:
+        for diff in changed:
+            PrintDiff(diff)
+        if unmatched:
+            print("Seeds only in one folder: " + ", ".join(unmatched))
+        print("{} of {} logs differ".format(len(changed), len(diffs)))
+
+    return 1 if changed or unmatched else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())